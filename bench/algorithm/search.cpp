@@ -0,0 +1,77 @@
+#include "nuenv/src/algorithm/eytzinger.hpp"
+#include "nuenv/src/algorithm/learned_index.hpp"
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+
+#include "bench/bench.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/random.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * Compares the sorted search backends on arrays from 16 to 10^8 elements
+ * (or up to the size given as the first argument), reporting nanoseconds per
+ * query for uniformly distributed random queries.
+ */
+int main(int argc, char** argv) {
+  using namespace nuenv;
+
+  const Index max_size = argc > 1 ? std::atol(argv[1]) : 100000000;
+  constexpr Index num_queries = 1 << 16;
+
+  minstd_rand gen(42);
+  uniform_real_distribution<double> dist(0.0, 1.0);
+
+  VectorX<double> queries(num_queries);
+  for (auto& q : queries) { q = dist(gen); }
+
+  std::printf("%12s %12s %12s %12s %12s %12s %12s\n", "size", "binary",
+			  "linear", "skiplist", "sorted_idx", "eytzinger", "learned");
+
+  for (Index size = 16; size <= max_size; size *= 4) {
+	VectorX<double> arr(size);
+	for (auto& a : arr) { a = dist(gen); }
+	std::sort(arr.begin(), arr.end());
+
+	const SortedIndex<double> sorted_index(arr);
+	const EytzingerIndex<double> eytzinger(arr);
+	const LearnedIndex<double> learned(arr);
+
+	Index sink = 0;
+	auto run = [&](auto search, Index n) {
+	  return bench::timeit([&]() {
+		for (Index i = 0; i < n; i++) { sink += search(queries[i]); }
+		bench::doNotOptimize(sink);
+	  }, n);
+	};
+
+	double t_binary = run([&](double q) {
+	  return internal::binarySearch(arr, q);
+	}, num_queries);
+
+	// The linear scan and the per-query skip list are O(n), keep them short
+	double t_linear = size <= (1 << 14)
+		? run([&](double q) { return internal::linearSortedSearch(arr, q); },
+			  std::max<Index>(1, num_queries * 16 / size))
+		: 0.0;
+	double t_skiplist = size <= (1 << 22)
+		? run([&](double q) { return internal::skiplistSearch(arr, q); },
+			  std::max<Index>(1, num_queries * 16 / size))
+		: 0.0;
+
+	double t_sorted = run([&](double q) { return sorted_index.search(q); },
+						  num_queries);
+	double t_eytzinger = run([&](double q) { return eytzinger.search(q); },
+							 num_queries);
+	double t_learned = run([&](double q) { return learned.search(q); },
+						   num_queries);
+
+	std::printf("%12ld %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n",
+				static_cast<long>(size), t_binary, t_linear, t_skiplist,
+				t_sorted, t_eytzinger, t_learned);
+  }
+
+  return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef NUENV_BENCH_BENCH_H_
+#define NUENV_BENCH_BENCH_H_
+
+#include <chrono>
+#include <cstdio>
+
+namespace nuenv::bench {
+
+/**
+ * @brief Time a callable, in nanoseconds per operation.
+ *
+ * The callable is run once to warm up and then repeatedly until at least
+ * 'min_time' seconds have elapsed.
+ *
+ * @param func Callable performing 'ops' operations per call.
+ * @param ops Number of operations performed by each call of 'func'.
+ * @param min_time Minimum measured time, in seconds.
+ *
+ * @return Mean time per operation, in nanoseconds.
+ */
+template<typename Func>
+double timeit(Func&& func, long ops, double min_time = 0.2) {
+  using Clock = std::chrono::steady_clock;
+
+  func();
+
+  long calls = 0;
+  const auto start = Clock::now();
+  std::chrono::duration<double> elapsed {};
+  do {
+	func();
+	calls++;
+	elapsed = Clock::now() - start;
+  } while (elapsed.count() < min_time);
+
+  return 1e9 * elapsed.count() / (static_cast<double>(calls) * ops);
+}
+
+/**
+ * @brief Prevent the compiler from discarding a computed value.
+ */
+template<typename T>
+void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace nuenv::bench
+
+#endif
@@ -0,0 +1,62 @@
+#include "nuenv/src/integrate/quadrature.hpp"
+
+#include "bench/bench.hpp"
+#include "nuenv/src/core/lambda.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <cstdlib>
+
+/**
+ * Compares the overhead of calling cheap integrands through a 'Lambda', a
+ * 'FunctionRef' and directly as a lambda, in 'quadratureA', from
+ * 1e-4 to 1e-12 (or to the tolerance given as the first argument), reporting
+ * nanoseconds per evaluation of the integrand.
+ */
+int main(int argc, char** argv) {
+  using namespace nuenv;
+
+  const double min_tol = argc > 1 ? std::atof(argv[1]) : 1e-12;
+
+  const auto polynomial = [](const double x) { return 1.0 + x * (0.5 - x * x); };
+  const auto rational = [](const double x) { return x * x / (1.0 + 100.0 * x * x); };
+
+  std::printf("%12s %12s %12s %12s %12s %12s %12s %12s\n", "tol", "evals",
+			  "poly_lambda", "poly_ref", "poly_inline", "rat_lambda", "rat_ref",
+			  "rat_inline");
+
+  for (double tol = 1e-4; tol >= min_tol; tol *= 1e-2) {
+	// Number of evaluations of each integral
+	Index evals = 0;
+	const Lambda<double(double)> counted = [&evals, &rational](const double x) {
+	  evals++;
+	  return rational(x);
+	};
+	quadratureA(counted, -1.0, 1.0, tol);
+
+	auto time = [&]<typename Func>(const Func& func) {
+	  return bench::timeit([&]() {
+		bench::doNotOptimize(quadratureA(func, -1.0, 1.0, tol));
+	  }, evals);
+	};
+
+	const Lambda<double(double)> poly_lambda = polynomial;
+	const FunctionRef<double(double)> poly_ref = polynomial;
+	const Lambda<double(double)> rat_lambda = rational;
+	const FunctionRef<double(double)> rat_ref = rational;
+
+	// The polynomial is integrated exactly by a single panel
+	const double t_poly_lambda = time(poly_lambda) * evals / 21.0;
+	const double t_poly_ref = time(poly_ref) * evals / 21.0;
+	const double t_poly_inline = time(polynomial) * evals / 21.0;
+
+	const double t_rat_lambda = time(rat_lambda);
+	const double t_rat_ref = time(rat_ref);
+	const double t_rat_inline = time(rational);
+
+	std::printf("%12.0e %12ld %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", tol,
+				static_cast<long>(evals), t_poly_lambda, t_poly_ref, t_poly_inline,
+				t_rat_lambda, t_rat_ref, t_rat_inline);
+  }
+
+  return 0;
+}
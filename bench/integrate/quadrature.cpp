@@ -0,0 +1,57 @@
+#include "nuenv/src/integrate/quadrature.hpp"
+
+#include "bench/bench.hpp"
+#include "nuenv/src/core/math.hpp"
+#include "nuenv/src/core/thread_pool.hpp"
+
+#include <cstdlib>
+#include <thread>
+
+/**
+ * Measures the scaling of the parallel adaptive quadrature of an oscillating
+ * integrand costing about a microsecond per evaluation, from 1 thread to the
+ * number of hardware threads (or to the number given as the first argument),
+ * reporting milliseconds per integral, the speedup over the serial
+ * quadrature and whether the result matches it bit for bit.
+ */
+int main(int argc, char** argv) {
+  using namespace nuenv;
+
+  const Index max_threads = argc > 1 ? std::atol(argv[1])
+									 : static_cast<Index>(std::thread::hardware_concurrency());
+
+  // Emulate an expensive integrand with a short series
+  const Lambda<double(double)> func = [](const double x) {
+	double sum = 0.0;
+	for (int k = 1; k <= 64; k++) { sum += sin(k * x) / (k * k); }
+	return sum * exp(0.5 * cos(40.0 * pi * x));
+  };
+
+  constexpr double a = 0.0;
+  constexpr double b = 1.0;
+  constexpr double tol = 1e-12;
+
+  double serial = 0.0;
+  const double t_serial = bench::timeit([&]() {
+	serial = quadratureA(func, a, b, tol);
+	bench::doNotOptimize(serial);
+  }, 1, 1.0);
+
+  std::printf("%12s %12s %12s %12s\n", "threads", "ms", "speedup", "identical");
+  std::printf("%12s %12.3f %12.2f %12s\n", "serial", 1e-6 * t_serial, 1.0, "yes");
+
+  for (Index threads = 1; threads <= max(max_threads, Index {1}); threads *= 2) {
+	ThreadPool pool(threads);
+
+	double result = 0.0;
+	const double t_parallel = bench::timeit([&]() {
+	  result = quadratureA(pool, func, a, b, tol);
+	  bench::doNotOptimize(result);
+	}, 1, 1.0);
+
+	std::printf("%12ld %12.3f %12.2f %12s\n", static_cast<long>(threads),
+				1e-6 * t_parallel, t_serial / t_parallel, result == serial ? "yes" : "no");
+  }
+
+  return 0;
+}
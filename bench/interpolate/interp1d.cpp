@@ -0,0 +1,73 @@
+#include "nuenv/src/interpolate/interp1d.hpp"
+
+#include "bench/bench.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/random.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * Compares point-by-point and batch interpolation, with and without
+ * precomputed segments, when resampling a series onto a new grid of the same
+ * size, from 16 to 10^6 points (or up to the size
+ * given as the first argument), reporting nanoseconds per point.
+ */
+int main(int argc, char** argv) {
+  using namespace nuenv;
+
+  const Index max_size = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+  minstd_rand gen(42);
+  uniform_real_distribution<double> dist(0.0, 1.0);
+
+  std::printf("%12s %12s %12s %12s %12s %12s %12s\n", "size", "linear",
+			  "linear_batch", "linear_pre", "exp", "exp_batch", "exp_pre");
+
+  for (Index size = 16; size <= max_size; size *= 4) {
+	VectorX<double> x(size);
+	for (auto& a : x) { a = dist(gen); }
+	std::sort(x.begin(), x.end());
+	const VectorX<double> y = 1.0 + x.array().sin();
+
+	Interp1d<double> interp(x, y, false);
+	Interp1d<double> precomputed(x, y, false, true);
+
+	const VectorX<double> queries = VectorX<double>::LinSpaced(size, 0.0, 1.0);
+	VectorX<double> out(size);
+
+	double t_linear = bench::timeit([&]() {
+	  for (Index i = 0; i < size; i++) { out[i] = interp.linear(queries[i]); }
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+	double t_linear_batch = bench::timeit([&]() {
+	  interp.linear(queries, out);
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+
+	double t_linear_pre = bench::timeit([&]() {
+	  for (Index i = 0; i < size; i++) { out[i] = precomputed.linear(queries[i]); }
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+
+	double t_exp = bench::timeit([&]() {
+	  for (Index i = 0; i < size; i++) { out[i] = interp.exponential(queries[i]); }
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+	double t_exp_batch = bench::timeit([&]() {
+	  interp.exponential(queries, out);
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+
+	double t_exp_pre = bench::timeit([&]() {
+	  for (Index i = 0; i < size; i++) { out[i] = precomputed.exponential(queries[i]); }
+	  bench::doNotOptimize(out[size - 1]);
+	}, size);
+
+	std::printf("%12ld %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n",
+				static_cast<long>(size), t_linear, t_linear_batch, t_linear_pre,
+				t_exp, t_exp_batch, t_exp_pre);
+  }
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+#ifndef NUENV_ALGORITHM_EYTZINGER_H_
+#define NUENV_ALGORITHM_EYTZINGER_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <bit>
+#include <type_traits>
+
+namespace nuenv {
+
+/**
+ * @class EytzingerIndex
+ *
+ * @brief Cache-friendly search index over a sorted array.
+ *
+ * Stores a copy of the keys in Eytzinger (breadth-first) order, so that the
+ * first levels of every search share the same few cache lines and the
+ * candidates of the next levels are contiguous and can be prefetched.
+ * It pays off for arrays much larger than the cache, where a plain binary
+ * search misses at almost every level.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @see Khuong, P. V., Morin, P., Array layouts for comparison-based searching.
+ *  Journal of Experimental Algorithmics, 22, 2017.
+ */
+template<typename Scalar>
+class EytzingerIndex {
+ public:
+  explicit EytzingerIndex(const VectorX<Scalar>& arr);
+
+  Index search(Scalar val) const;
+
+  Index size() const;
+
+ private:
+  Index build(const VectorX<Scalar>& arr, Index i, Index k);
+
+  // Number of keys sharing a cache line, looked ahead by the prefetch
+  static constexpr Index kBlock = max<Index>(1, 64 / sizeof(Scalar));
+
+  Index size_;
+  VectorX<Scalar> keys_;
+  VectorX<Index> rank_;
+};
+
+/**
+ * Constructs the index.
+ *
+ * @param arr Sorted array to be indexed. Must not be empty. The keys are
+ *  copied, so the array does not need to outlive the index.
+ */
+template<typename Scalar>
+EytzingerIndex<Scalar>::EytzingerIndex(const VectorX<Scalar>& arr)
+	: size_(arr.size()), keys_(arr.size() + 1), rank_(arr.size() + 1) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  // Position 0 is the sentinel reached when no key is greater than the value
+  keys_[0] = arr[size_ - 1];
+  rank_[0] = size_;
+
+  build(arr, 0, 1);
+}
+
+/**
+ * @brief Fill the tree rooted at 'k' by an in-order traversal.
+ *
+ * @param arr Sorted array being indexed.
+ * @param i Next element of 'arr' to be placed.
+ * @param k Position in Eytzinger order.
+ *
+ * @return Next element of 'arr' to be placed after the tree rooted at 'k'.
+ */
+template<typename Scalar>
+Index EytzingerIndex<Scalar>::build(const VectorX<Scalar>& arr,
+									Index i,
+									Index k) {
+  if (k <= size_) {
+	i = build(arr, i, 2 * k);
+	keys_[k] = arr[i];
+	rank_[k] = i++;
+	i = build(arr, i, 2 * k + 1);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Find the interval of the indexed array containing a value.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'arr[i] <= val < arr[i + 1]', clamped to the
+ *  bounds of the array.
+ */
+template<typename Scalar>
+Index EytzingerIndex<Scalar>::search(Scalar val) const {
+  using Unsigned = std::make_unsigned_t<Index>;
+
+  const Scalar* keys = keys_.data();
+
+  Index k = 1;
+  while (k <= size_) {
+#if defined(__GNUC__)
+	__builtin_prefetch(keys + kBlock * k);
+#endif
+	k = 2 * k + !(val < keys[k]);
+  }
+
+  // Undo the right turns taken after the last left turn, which leaves the
+  // first key greater than 'val'
+  k >>= std::countr_one(static_cast<Unsigned>(k)) + 1;
+
+  Index upper = rank_[k];
+
+  return upper - (upper > 0);
+}
+
+/**
+ * @brief Number of elements of the indexed array.
+ */
+template<typename Scalar>
+Index EytzingerIndex<Scalar>::size() const {
+  return size_;
+}
+
+template<typename Scalar>
+Index SearchSorted(const EytzingerIndex<Scalar>& index, Scalar val) {
+  return index.search(val);
+}
+
+} // namespace nuenv
+
+#endif
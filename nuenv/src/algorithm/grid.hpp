@@ -0,0 +1,385 @@
+#ifndef NUENV_ALGORITHM_GRID_H_
+#define NUENV_ALGORITHM_GRID_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <concepts>
+
+namespace nuenv {
+
+namespace internal {
+
+/**
+ * @brief Clamp an estimated fractional position to a cell index.
+ *
+ * Non-finite positions are clamped to the last cell.
+ */
+template<typename Scalar>
+Index gridCell(Scalar pos, Index size) {
+  if (!(pos < static_cast<Scalar>(size - 1))) { return size - 1; }
+  if (!(pos > 0)) { return 0; }
+
+  return static_cast<Index>(pos);
+}
+
+/**
+ * @brief Correct an estimated cell index against the actual grid values.
+ *
+ * The estimate only needs to be close, so the result is exact even when the
+ * grid values are affected by rounding or only nearly follow the model.
+ */
+template<typename Array, typename Scalar>
+Index gridCorrect(const Array& arr, Index size, Scalar val, Index i) {
+  while (i > 0 && val < arr[i]) { --i; }
+  while (i < size - 1 && !(val < arr[i + 1])) { ++i; }
+
+  return i;
+}
+
+} // namespace internal
+
+/**
+ * @brief Evenly spaced grid, as generated by 'LinearSpace'.
+ *
+ * The grid is described by its bounds and number of points, so its values are
+ * computed on demand and searching it takes constant time.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class UniformGrid {
+ public:
+  using value_type = Scalar;
+
+  UniformGrid(Scalar start, Scalar stop, Index num);
+
+  Scalar operator[](Index i) const;
+
+  Index size() const { return num_; }
+
+  Index search(Scalar val) const;
+
+  VectorX<Scalar> toVector() const;
+
+ private:
+  Scalar start_;
+  Scalar stop_;
+  Index num_;
+  Scalar step_;
+  Scalar inv_step_;
+};
+
+/**
+ * Constructs the grid.
+ *
+ * @param start Starting value of the sequence.
+ * @param stop End value of the sequence. Must be greater than 'start'.
+ * @param num Number of samples. Must be at least 2, as the spacing is
+ *  defined by the two bounds.
+ */
+template<typename Scalar>
+UniformGrid<Scalar>::UniformGrid(Scalar start, Scalar stop, Index num)
+	: start_(start),
+	  stop_(stop),
+	  num_(num),
+	  step_((stop - start) / static_cast<Scalar>(num - 1)),
+	  inv_step_(1.0 / step_) {
+  assert((num > 1) && "Grid must have at least two points");
+}
+
+/**
+ * @brief Value of the i-th point of the grid.
+ */
+template<typename Scalar>
+Scalar UniformGrid<Scalar>::operator[](Index i) const {
+  return i == num_ - 1 ? stop_ : start_ + static_cast<Scalar>(i) * step_;
+}
+
+/**
+ * @brief Find the cell of the grid containing a value in constant time.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'grid[i] <= val < grid[i + 1]', clamped to the
+ *  bounds of the grid.
+ */
+template<typename Scalar>
+Index UniformGrid<Scalar>::search(Scalar val) const {
+  Index i = internal::gridCell((val - start_) * inv_step_, num_);
+
+  return internal::gridCorrect(*this, num_, val, i);
+}
+
+/**
+ * @brief Materialize the grid into an array.
+ */
+template<typename Scalar>
+VectorX<Scalar> UniformGrid<Scalar>::toVector() const {
+  VectorX<Scalar> arr(num_);
+  for (Index i = 0; i < num_; i++) { arr[i] = (*this)[i]; }
+
+  // Returns with copy elision
+  return arr;
+}
+
+/**
+ * @brief Grid evenly spaced on a log scale, as generated by
+ *  'LogarithmicSpace'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class LogarithmicGrid {
+ public:
+  using value_type = Scalar;
+
+  LogarithmicGrid(Scalar start, Scalar stop, Index num);
+
+  Scalar operator[](Index i) const;
+
+  Index size() const { return num_; }
+
+  Index search(Scalar val) const;
+
+  VectorX<Scalar> toVector() const;
+
+ private:
+  Scalar start_;
+  Scalar stop_;
+  Index num_;
+  Scalar start_log_;
+  Scalar step_;
+  Scalar inv_step_;
+};
+
+/**
+ * Constructs the grid.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence. Must be greater than 'start'.
+ * @param num Number of samples. Must be at least 2, as the spacing is
+ *  defined by the two bounds.
+ */
+template<typename Scalar>
+LogarithmicGrid<Scalar>::LogarithmicGrid(Scalar start, Scalar stop, Index num)
+	: start_(start),
+	  stop_(stop),
+	  num_(num),
+	  start_log_(log2(start)),
+	  step_((log2(stop) - start_log_) / static_cast<Scalar>(num - 1)),
+	  inv_step_(1.0 / step_) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
+  assert((num > 1) && "Grid must have at least two points");
+}
+
+/**
+ * @brief Value of the i-th point of the grid.
+ */
+template<typename Scalar>
+Scalar LogarithmicGrid<Scalar>::operator[](Index i) const {
+  if (i == 0) { return start_; }
+  if (i == num_ - 1) { return stop_; }
+
+  return exp2(start_log_ + static_cast<Scalar>(i) * step_);
+}
+
+/**
+ * @brief Find the cell of the grid containing a value in constant time.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'grid[i] <= val < grid[i + 1]', clamped to the
+ *  bounds of the grid.
+ */
+template<typename Scalar>
+Index LogarithmicGrid<Scalar>::search(Scalar val) const {
+  // Also keeps non-positive values from the log, which would land on the
+  // last cell and be walked back over the whole grid
+  if (val <= start_) { return 0; }
+
+  Index i = internal::gridCell((log2(val) - start_log_) * inv_step_, num_);
+
+  return internal::gridCorrect(*this, num_, val, i);
+}
+
+/**
+ * @brief Materialize the grid into an array.
+ */
+template<typename Scalar>
+VectorX<Scalar> LogarithmicGrid<Scalar>::toVector() const {
+  VectorX<Scalar> arr(num_);
+  for (Index i = 0; i < num_; i++) { arr[i] = (*this)[i]; }
+
+  // Returns with copy elision
+  return arr;
+}
+
+/**
+ * @brief Grid with a geometric progression of points, as generated by
+ *  'geometricSpace'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class GeometricGrid {
+ public:
+  using value_type = Scalar;
+
+  GeometricGrid(Scalar start, Scalar stop, Index num);
+
+  Scalar operator[](Index i) const;
+
+  Index size() const { return num_; }
+
+  Index search(Scalar val) const;
+
+  VectorX<Scalar> toVector() const;
+
+ private:
+  Scalar start_;
+  Scalar stop_;
+  Index num_;
+  Scalar ratio_;
+  Scalar inv_log_ratio_;
+};
+
+/**
+ * Constructs the grid.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence. Must be greater than 'start'.
+ * @param num Number of samples. Must be at least 2, as the spacing is
+ *  defined by the two bounds.
+ */
+template<typename Scalar>
+GeometricGrid<Scalar>::GeometricGrid(Scalar start, Scalar stop, Index num)
+	: start_(start),
+	  stop_(stop),
+	  num_(num),
+	  ratio_(pow(stop / start, 1.0 / (static_cast<Scalar>(num) - 1.0))),
+	  inv_log_ratio_(1.0 / log(ratio_)) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
+  assert((num > 1) && "Grid must have at least two points");
+}
+
+/**
+ * @brief Value of the i-th point of the grid.
+ */
+template<typename Scalar>
+Scalar GeometricGrid<Scalar>::operator[](Index i) const {
+  return i == num_ - 1 ? stop_ : start_ * pow(ratio_, i);
+}
+
+/**
+ * @brief Find the cell of the grid containing a value in constant time.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'grid[i] <= val < grid[i + 1]', clamped to the
+ *  bounds of the grid.
+ */
+template<typename Scalar>
+Index GeometricGrid<Scalar>::search(Scalar val) const {
+  // Also keeps non-positive values from the log, see 'LogarithmicGrid::search'
+  if (val <= start_) { return 0; }
+
+  Index i = internal::gridCell(log(val / start_) * inv_log_ratio_, num_);
+
+  return internal::gridCorrect(*this, num_, val, i);
+}
+
+/**
+ * @brief Materialize the grid into an array.
+ */
+template<typename Scalar>
+VectorX<Scalar> GeometricGrid<Scalar>::toVector() const {
+  VectorX<Scalar> arr(num_);
+  for (Index i = 0; i < num_; i++) { arr[i] = (*this)[i]; }
+
+  // Returns with copy elision
+  return arr;
+}
+
+/**
+ * @brief Grid whose points are described arithmetically and searched in
+ *  constant time.
+ */
+template<typename Grid>
+concept SpaceGrid = requires(const Grid& grid, typename Grid::value_type val) {
+  { grid.search(val) } -> std::same_as<Index>;
+  { grid.toVector() } -> std::same_as<VectorX<typename Grid::value_type>>;
+};
+
+template<SpaceGrid Grid>
+Index SearchSorted(const Grid& grid, typename Grid::value_type val) {
+  return grid.search(val);
+}
+
+/**
+ * @brief Check whether a sorted array is (nearly) evenly spaced.
+ *
+ * @tparam Derived Vector type, such as 'VectorX' or 'VectorView'.
+ *
+ * @param arr Array to check.
+ * @param tol Largest deviation from an evenly spaced array, relative to the
+ *  spacing. Default is 1e-3.
+ *
+ * @return True if every point is within tolerance of the evenly spaced array
+ *  with the same bounds and size, false otherwise.
+ */
+template<typename Derived>
+bool IsUniform(const Eigen::DenseBase<Derived>& arr, typename Derived::Scalar tol = 1e-3) {
+  using Scalar = typename Derived::Scalar;
+
+  Index size = arr.size();
+  if (size < 2) { return false; }
+
+  Scalar step = (arr[size - 1] - arr[0]) / static_cast<Scalar>(size - 1);
+  if (!(step > 0)) { return false; }
+
+  for (Index i = 1; i < size - 1; i++) {
+	if (!(abs(arr[i] - (arr[0] + static_cast<Scalar>(i) * step)) <= tol * step)) {
+	  return false;
+	}
+  }
+
+  return true;
+}
+
+/**
+ * @brief Check whether a sorted array is (nearly) evenly spaced on a log
+ *  scale, that is, a geometric progression.
+ *
+ * @tparam Derived Vector type, such as 'VectorX' or 'VectorView'.
+ *
+ * @param arr Array to check.
+ * @param tol Largest deviation from an evenly spaced array on a log scale,
+ *  relative to the spacing. Default is 1e-3.
+ *
+ * @return True if every point is positive and within tolerance of the
+ *  geometric progression with the same bounds and size, false otherwise.
+ */
+template<typename Derived>
+bool IsLogUniform(const Eigen::DenseBase<Derived>& arr, typename Derived::Scalar tol = 1e-3) {
+  using Scalar = typename Derived::Scalar;
+
+  Index size = arr.size();
+  if (size < 2 || !(arr[0] > 0)) { return false; }
+
+  Scalar start_log = log2(arr[0]);
+  Scalar step = (log2(arr[size - 1]) - start_log) / static_cast<Scalar>(size - 1);
+  if (!(step > 0)) { return false; }
+
+  for (Index i = 1; i < size - 1; i++) {
+	Scalar expected = start_log + static_cast<Scalar>(i) * step;
+	if (!(abs(log2(arr[i]) - expected) <= tol * step)) { return false; }
+  }
+
+  return true;
+}
+
+} // namespace nuenv
+
+#endif
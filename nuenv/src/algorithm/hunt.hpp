@@ -0,0 +1,121 @@
+#ifndef NUENV_ALGORITHM_HUNT_H_
+#define NUENV_ALGORITHM_HUNT_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <type_traits>
+
+namespace nuenv {
+
+/**
+ * @class SearchCursor
+ *
+ * @brief Stateful search over a sorted array for correlated queries.
+ *
+ * Remembers the cell found by the last query and hunts for the next one from
+ * there: the last cell is checked first, then the search gallops outward in
+ * exponentially growing steps until the value is bracketed and finally
+ * bisects the bracket. Monotone or otherwise correlated query streams, such
+ * as the ones produced by stepping a solver or sweeping an interpolant, are
+ * then located in amortized constant time, while arbitrary jumps cost at most
+ * twice a binary search.
+ *
+ * A cursor is cheap to copy and holds no reference to the array, so it may be
+ * used with different arrays, but it is only effective while the queries on
+ * the same array are correlated. It is not thread-safe: each thread should
+ * use its own cursor.
+ *
+ * @see Press, W. H. et al., Numerical Recipes: The Art of Scientific
+ *  Computing, 3rd ed. Cambridge University Press, 2007. Section 3.1.
+ */
+class SearchCursor {
+ public:
+  SearchCursor() : index_(0) {}
+
+  explicit SearchCursor(Index index) : index_(index) {}
+
+  template<typename Scalar, typename Array>
+  Index search(const Array& arr, Scalar val);
+
+  Index index() const { return index_; }
+
+  void reset() { index_ = 0; }
+
+ private:
+  Index index_;
+};
+
+/**
+ * @brief Find the interval of a sorted array containing a value, starting
+ *  from the interval found by the last search.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Array Vector type, such as 'VectorX' or 'VectorView'.
+ *
+ * @param arr Sorted array to search. Must not be empty.
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'arr[i] <= val < arr[i + 1]', clamped to the
+ *  bounds of the array.
+ */
+template<typename Scalar, typename Array>
+Index SearchCursor::search(const Array& arr, Scalar val) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  Index size = arr.size();
+  Index lo = min(max<Index>(index_, 0), size - 1);
+  Index hi;
+
+  if (!(val < arr[lo])) {
+	// Hunt up
+	Index inc = 1;
+	hi = lo + 1;
+	while (hi < size && !(val < arr[hi])) {
+	  lo = hi;
+	  inc *= 2;
+	  hi = lo + inc;
+	}
+
+	hi = min(hi, size);
+  } else {
+	// Hunt down
+	Index inc = 1;
+	do {
+	  hi = lo;
+	  lo = max<Index>(hi - inc, 0);
+	  inc *= 2;
+	} while (lo > 0 && val < arr[lo]);
+
+	// Bounds checking
+	if (val < arr[lo]) {
+	  index_ = 0;
+	  return index_;
+	}
+  }
+
+  // Bisection, keeping 'arr[lo] <= val < arr[hi]'
+  while (hi - lo > 1) {
+	Index mid = (lo + hi) / 2;
+	if (val < arr[mid]) {
+	  hi = mid;
+	} else {
+	  lo = mid;
+	}
+  }
+
+  index_ = lo;
+  return index_;
+}
+
+template<typename Scalar>
+Index SearchSorted(const std::type_identity_t<VectorRef<Scalar>>& arr,
+				   Scalar val,
+				   SearchCursor& cursor) {
+  return cursor.search(arr, val);
+}
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef NUENV_ALGORITHM_LEARNEDINDEX_H_
+#define NUENV_ALGORITHM_LEARNEDINDEX_H_
+
+#include "nuenv/src/algorithm/grid.hpp"
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <type_traits>
+
+namespace nuenv {
+
+/**
+ * @class LearnedIndex
+ *
+ * @brief Search index over a sorted array that predicts the position of a
+ *  value with a piecewise linear model.
+ *
+ * The model maps every key of the array to its position with an error of at
+ * most 'epsilon', so a query is located by finding its segment, evaluating
+ * the segment's line and binary searching a window of '2 * epsilon + 3'
+ * elements around the prediction. For keys that are close to uniformly
+ * distributed a handful of segments suffice, and the search costs far fewer
+ * probes than a binary search over the whole array.
+ *
+ * The index holds a reference to the data, which must outlive it and must not
+ * be modified while the index is in use. The data may also be caller memory
+ * viewed through a 'VectorView'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam epsilon Largest error of the predicted positions.
+ *
+ * @see Ferragina, P., Vinciguerra, G., The PGM-index: a fully-dynamic
+ *  compressed learned index with provable worst-case bounds. Proceedings of
+ *  the VLDB Endowment, 13(8), 2020.
+ */
+template<typename Scalar, Index epsilon = 16>
+class LearnedIndex {
+ public:
+  // Number of elements searched around a predicted position
+  static constexpr Index kWindow = 2 * epsilon + 3;
+
+  explicit LearnedIndex(const VectorX<Scalar>& arr);
+
+  explicit LearnedIndex(VectorView<Scalar> arr);
+
+  LearnedIndex(const VectorX<Scalar>&& arr) = delete;
+
+  Index search(Scalar val) const;
+
+  Index size() const { return size_; }
+
+  Index segments() const { return keys_.size(); }
+
+ private:
+  // Model arithmetic is done in floating point, also for integer keys
+  using Real = std::conditional_t<std::is_floating_point_v<Scalar>, Scalar, double>;
+
+  const Scalar* data_;
+  Index size_;
+  VectorX<Scalar> keys_;
+  VectorX<Real> slopes_;
+  VectorX<Index> starts_;
+};
+
+/**
+ * Constructs the index.
+ *
+ * @param arr Sorted array to be indexed. Must not be empty.
+ */
+template<typename Scalar, Index epsilon>
+LearnedIndex<Scalar, epsilon>::LearnedIndex(const VectorX<Scalar>& arr)
+	: LearnedIndex(VectorView<Scalar>(arr.data(), arr.size())) {}
+
+/**
+ * Constructs the index over a view, fitting the segments greedily: each one
+ * is extended while some line through its first point stays within 'epsilon'
+ * of the positions of all its points.
+ *
+ * @param arr Sorted array to be indexed. Must not be empty.
+ */
+template<typename Scalar, Index epsilon>
+LearnedIndex<Scalar, epsilon>::LearnedIndex(VectorView<Scalar> arr)
+	: data_(arr.data()), size_(arr.size()) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  constexpr Real inf = numeric_limits<Real>::infinity();
+  const Real eps = static_cast<Real>(epsilon);
+
+  VectorT<Scalar> keys;
+  VectorT<Real> slopes;
+  VectorT<Index> starts;
+
+  Index size = arr.size();
+  Index start = 0;
+  while (start < size) {
+	// Range of slopes keeping every point of the segment within tolerance
+	Real lo = -inf, hi = inf;
+
+	Index i = start + 1;
+	for (; i < size; ++i) {
+	  Real dx = static_cast<Real>(arr[i]) - static_cast<Real>(arr[start]);
+	  Real dy = static_cast<Real>(i - start);
+
+	  if (dx == 0) {
+		if (dy > eps) { break; }
+		continue;
+	  }
+
+	  Real new_lo = max(lo, (dy - eps) / dx);
+	  Real new_hi = min(hi, (dy + eps) / dx);
+	  if (new_lo > new_hi) { break; }
+
+	  lo = new_lo;
+	  hi = new_hi;
+	}
+
+	keys.push_back(arr[start]);
+	slopes.push_back(lo == -inf ? 0 : max<Real>((lo + hi) / 2, 0));
+	starts.push_back(start);
+
+	start = i;
+  }
+
+  Index num = static_cast<Index>(keys.size());
+  keys_ = Eigen::Map<VectorX<Scalar>>(keys.data(), num);
+  slopes_ = Eigen::Map<VectorX<Real>>(slopes.data(), num);
+  starts_ = Eigen::Map<VectorX<Index>>(starts.data(), num);
+}
+
+/**
+ * @brief Find the interval of the indexed array containing a value.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'arr[i] <= val < arr[i + 1]', clamped to the
+ *  bounds of the array.
+ */
+template<typename Scalar, Index epsilon>
+Index LearnedIndex<Scalar, epsilon>::search(Scalar val) const {
+  const VectorView<Scalar> arr(data_, size_);
+  Index size = size_;
+
+  Index s = internal::binarySearch(keys_, val);
+  Real dx = static_cast<Real>(val) - static_cast<Real>(keys_[s]);
+  Real pos = static_cast<Real>(starts_[s]) + slopes_[s] * dx;
+  Index p = internal::gridCell(pos, size);
+
+  Index begin = max<Index>(p - epsilon - 1, 0);
+  Index end = min<Index>(p + epsilon + 2, size);
+
+  // The window is guaranteed for the keys, verify it for values between them
+  if ((begin > 0 && val < arr[begin]) || (end < size && !(val < arr[end]))) {
+	return internal::binarySearch(arr, val);
+  }
+
+  return internal::binarySearch(arr, val, begin, end);
+}
+
+template<typename Scalar, Index epsilon>
+Index SearchSorted(const LearnedIndex<Scalar, epsilon>& index, Scalar val) {
+  return index.search(val);
+}
+
+} // namespace nuenv
+
+#endif
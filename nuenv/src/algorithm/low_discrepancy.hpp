@@ -0,0 +1,328 @@
+#ifndef NUENV_ALGORITHM_LOWDISCREPANCY_H_
+#define NUENV_ALGORITHM_LOWDISCREPANCY_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+#include "nuenv/src/core/random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+
+namespace nuenv {
+
+namespace internal {
+
+struct ConstsHalton {
+  static constexpr Index kMaxDim = 32;
+
+  static constexpr std::array<uint64_t, kMaxDim> kPrimes = {
+	  2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+	  59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+  };
+};
+
+/**
+ * Primitive polynomials and initial direction numbers of the Sobol sequence,
+ * for dimensions 2 and up. The first dimension is the van der Corput
+ * sequence in base 2.
+ *
+ * @see Joe, S., Kuo, F. Y., Constructing Sobol sequences with better
+ *  two-dimensional projections. SIAM Journal on Scientific Computing, 30(5),
+ *  2008. Direction numbers 'new-joe-kuo-6.21201'.
+ */
+struct ConstsSobol {
+  static constexpr Index kMaxDim = 21;
+  static constexpr Index kBits = 32;
+
+  struct Polynomial {
+	uint32_t degree;
+	uint32_t coeffs;
+	std::array<uint32_t, 7> m;
+  };
+
+  static constexpr std::array<Polynomial, kMaxDim - 1> kPolynomials = {{
+	  {1, 0, {1}},
+	  {2, 1, {1, 3}},
+	  {3, 1, {1, 3, 1}},
+	  {3, 2, {1, 1, 1}},
+	  {4, 1, {1, 1, 3, 3}},
+	  {4, 4, {1, 3, 5, 13}},
+	  {5, 2, {1, 1, 5, 5, 17}},
+	  {5, 4, {1, 1, 5, 5, 5}},
+	  {5, 7, {1, 1, 7, 11, 19}},
+	  {5, 11, {1, 1, 5, 1, 1}},
+	  {5, 13, {1, 1, 1, 3, 11}},
+	  {5, 14, {1, 3, 5, 5, 31}},
+	  {6, 1, {1, 3, 3, 9, 7, 49}},
+	  {6, 13, {1, 1, 1, 15, 21, 21}},
+	  {6, 16, {1, 3, 1, 13, 27, 49}},
+	  {6, 19, {1, 1, 1, 15, 7, 5}},
+	  {6, 22, {1, 3, 1, 15, 13, 25}},
+	  {6, 25, {1, 1, 5, 5, 19, 61}},
+	  {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+	  {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+  }};
+};
+
+} // namespace internal
+
+/**
+ * @class HaltonSequence
+ *
+ * @brief Halton low-discrepancy sequence.
+ *
+ * Each dimension is the radical inverse of the point index in a different
+ * prime base. Points are generated in bulk and the sequence can be skipped
+ * ahead to any position, so disjoint blocks can be generated in parallel.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class HaltonSequence {
+ public:
+  explicit HaltonSequence(Index dim, Index offset = 0);
+
+  MatrixSQX<Scalar> generate(Index num);
+
+  void skip(Index num) { position_ += num; }
+
+  Index dim() const { return dim_; }
+
+  Index position() const { return position_; }
+
+ private:
+  static Scalar radicalInverse(uint64_t k, uint64_t base);
+
+  Index dim_;
+  Index position_;
+};
+
+/**
+ * Constructs the sequence.
+ *
+ * @param dim Number of dimensions, from 1 to 32.
+ * @param offset Index of the first point to be generated. Default is 0.
+ */
+template<typename Scalar>
+HaltonSequence<Scalar>::HaltonSequence(Index dim, Index offset)
+	: dim_(dim), position_(offset) {
+  assert((dim > 0 && dim <= internal::ConstsHalton::kMaxDim) && "Unsupported dimension");
+}
+
+/**
+ * @brief Generate the next points of the sequence.
+ *
+ * @param num Number of points.
+ *
+ * @return Matrix of size 'dim x num' with one point in [0, 1)^dim per column.
+ */
+template<typename Scalar>
+MatrixSQX<Scalar> HaltonSequence<Scalar>::generate(Index num) {
+  MatrixSQX<Scalar> points(dim_, num);
+
+  for (Index j = 0; j < num; j++) {
+	uint64_t k = static_cast<uint64_t>(position_ + j);
+	for (Index d = 0; d < dim_; d++) {
+	  points(d, j) = radicalInverse(k, internal::ConstsHalton::kPrimes[d]);
+	}
+  }
+
+  position_ += num;
+
+  // Returns with copy elision
+  return points;
+}
+
+/**
+ * @brief Reflect the digits of 'k' in 'base' about the radix point.
+ */
+template<typename Scalar>
+Scalar HaltonSequence<Scalar>::radicalInverse(uint64_t k, uint64_t base) {
+  const Scalar inv_base = 1.0 / static_cast<Scalar>(base);
+
+  Scalar factor = inv_base;
+  Scalar result = 0.0;
+  while (k > 0) {
+	result += factor * static_cast<Scalar>(k % base);
+	k /= base;
+	factor *= inv_base;
+  }
+
+  return result;
+}
+
+/**
+ * @class SobolSequence
+ *
+ * @brief Sobol low-discrepancy sequence.
+ *
+ * Points are generated in Gray code order, so each one is obtained from the
+ * previous one with a single XOR per dimension, and the sequence can be
+ * skipped ahead to any position in O(log n), so disjoint blocks can be
+ * generated in parallel. Up to 2^32 points are supported.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @see Bratley, P., Fox, B. L., Algorithm 659: Implementing Sobol's
+ *  quasirandom sequence generator. ACM Transactions on Mathematical Software,
+ *  14(1), 1988.
+ */
+template<typename Scalar>
+class SobolSequence {
+ public:
+  explicit SobolSequence(Index dim, Index offset = 0);
+
+  MatrixSQX<Scalar> generate(Index num);
+
+  void skip(Index num);
+
+  Index dim() const { return dim_; }
+
+  Index position() const { return position_; }
+
+ private:
+  using Consts = internal::ConstsSobol;
+
+  Index dim_;
+  Index position_;
+  void flip(Index bit);
+
+  // Direction numbers, one row per dimension, so that the numbers of the same
+  // bit are contiguous
+  Eigen::Matrix<uint32_t, Eigen::Dynamic, Consts::kBits> directions_;
+  VectorX<uint32_t> state_;
+};
+
+/**
+ * Constructs the sequence.
+ *
+ * @param dim Number of dimensions, from 1 to 21.
+ * @param offset Index of the first point to be generated. Default is 0.
+ */
+template<typename Scalar>
+SobolSequence<Scalar>::SobolSequence(Index dim, Index offset)
+	: dim_(dim), position_(0), directions_(dim, Consts::kBits), state_(dim) {
+  assert((dim > 0 && dim <= Consts::kMaxDim) && "Unsupported dimension");
+
+  constexpr Index bits = Consts::kBits;
+
+  for (Index i = 0; i < bits; i++) {
+	directions_(0, i) = uint32_t {1} << (bits - 1 - i);
+  }
+
+  for (Index d = 1; d < dim; d++) {
+	const auto& poly = Consts::kPolynomials[d - 1];
+	const Index s = poly.degree;
+
+	for (Index i = 0; i < s; i++) {
+	  directions_(d, i) = poly.m[i] << (bits - 1 - i);
+	}
+
+	for (Index i = s; i < bits; i++) {
+	  uint32_t v = directions_(d, i - s) ^ (directions_(d, i - s) >> s);
+	  for (Index k = 1; k < s; k++) {
+		v ^= ((poly.coeffs >> (s - 1 - k)) & 1u) * directions_(d, i - k);
+	  }
+	  directions_(d, i) = v;
+	}
+  }
+
+  state_.setZero();
+  skip(offset);
+}
+
+/**
+ * @brief Generate the next points of the sequence.
+ *
+ * @param num Number of points.
+ *
+ * @return Matrix of size 'dim x num' with one point in [0, 1)^dim per column.
+ */
+template<typename Scalar>
+MatrixSQX<Scalar> SobolSequence<Scalar>::generate(Index num) {
+  constexpr Scalar scale = 1.0 / 4294967296.0;
+
+  MatrixSQX<Scalar> points(dim_, num);
+
+  for (Index j = 0; j < num; j++) {
+	points.col(j) = state_.template cast<Scalar>() * scale;
+
+	// The next Gray code differs in the lowest zero bit of the position
+	flip(std::countr_one(static_cast<uint64_t>(position_)));
+	position_++;
+  }
+
+  // Returns with copy elision
+  return points;
+}
+
+/**
+ * @brief Skip ahead a number of points.
+ *
+ * @param num Number of points to skip.
+ */
+template<typename Scalar>
+void SobolSequence<Scalar>::skip(Index num) {
+  position_ += num;
+
+  uint64_t gray = static_cast<uint64_t>(position_) ^ (static_cast<uint64_t>(position_) >> 1);
+
+  state_.setZero();
+  for (Index i = 0; gray != 0; i++, gray >>= 1) {
+	if (gray & 1u) { flip(i); }
+  }
+}
+
+/**
+ * @brief Toggle a bit of the Gray code of the current point.
+ */
+template<typename Scalar>
+void SobolSequence<Scalar>::flip(Index bit) {
+  for (Index d = 0; d < dim_; d++) { state_[d] ^= directions_(d, bit); }
+}
+
+/**
+ * @brief Generate a Latin hypercube sample.
+ *
+ * Each dimension is divided into 'num' strata of equal width and every
+ * stratum holds exactly one point, placed uniformly at random within it.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Generator Uniform random bit generator.
+ *
+ * @param dim Number of dimensions.
+ * @param num Number of points.
+ * @param gen Random number generator.
+ *
+ * @return Matrix of size 'dim x num' with one point in [0, 1)^dim per column.
+ */
+template<typename Scalar, class Generator>
+MatrixSQX<Scalar> LatinHypercube(Index dim, Index num, Generator& gen) {
+  uniform_real_distribution<Scalar> jitter(0.0, 1.0);
+
+  MatrixSQX<Scalar> points(dim, num);
+  VectorT<Index> strata(num);
+
+  const Scalar inv_num = 1.0 / static_cast<Scalar>(num);
+
+  for (Index d = 0; d < dim; d++) {
+	std::iota(strata.begin(), strata.end(), 0);
+	std::shuffle(strata.begin(), strata.end(), gen);
+
+	for (Index j = 0; j < num; j++) {
+	  Scalar u = min<Scalar>(jitter(gen), 1.0 - numeric_limits<Scalar>::epsilon());
+	  points(d, j) = (static_cast<Scalar>(strata[j]) + u) * inv_num;
+	}
+  }
+
+  // Returns with copy elision
+  return points;
+}
+
+} // namespace nuenv
+
+#endif
@@ -2,6 +2,11 @@
 #define NUENV_ALGORITHM_SEARCH_H_
 
 #include "nuenv/core"
+#include "nuenv/src/algorithm/simd_search.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <type_traits>
 
 namespace nuenv {
 
@@ -12,8 +17,8 @@ T bchoice(bool condition, T v_true, T v_false) {
   return (condition * v_true) | (!condition * v_false);
 }
 
-template<typename Scalar>
-Index linearSearch(const VectorX<Scalar>& arr,
+template<typename Scalar, typename Array>
+Index linearSearch(const Array& arr,
 				   Scalar val,
 				   Index begin = 0,
 				   Index end = 0) {
@@ -32,8 +37,8 @@ Index linearSearch(const VectorX<Scalar>& arr,
   return size;
 }
 
-template<typename Scalar>
-Index linearSortedSearch(const VectorX<Scalar>& arr,
+template<typename Scalar, typename Array>
+Index linearSortedSearch(const Array& arr,
 						 Scalar val,
 						 Index begin = 0,
 						 Index end = 0) {
@@ -49,8 +54,8 @@ Index linearSortedSearch(const VectorX<Scalar>& arr,
   return end - bchoice(cnt > end, end, cnt);
 }
 
-template<typename Scalar>
-Index binarySearch(const VectorX<Scalar>& arr,
+template<typename Scalar, typename Array>
+Index binarySearch(const Array& arr,
 				   Scalar val,
 				   Index begin = 0,
 				   Index end = 0) {
@@ -74,8 +79,21 @@ Index binarySearch(const VectorX<Scalar>& arr,
   return begin;
 }
 
-template<typename Scalar, Index skip = 8>
-Index skiplistSearch(const VectorX<Scalar>& arr,
+template<typename Scalar, Index skip = 8, typename Array>
+Index skiplistSearch(const Array& arr,
+					 const VectorX<Scalar>& skplst,
+					 Scalar val) {
+  assert((skplst.size() > 0) && "Skip list must not be empty");
+
+  Index end = 0;
+  Index j = binarySearch(skplst, val);
+  if (j < skplst.size() - 1) { end = (j + 1) * skip; }
+
+  return linearSortedSearch(arr, val, skip * j, end);
+}
+
+template<typename Scalar, Index skip = 8, typename Array>
+Index skiplistSearch(const Array& arr,
 					 Scalar val,
 					 Index begin = 0,
 					 Index end = 0) {
@@ -94,22 +112,237 @@ Index skiplistSearch(const VectorX<Scalar>& arr,
   return begin;
 }
 
+/**
+ * @brief Whether queries can be located with 'mergeSearch', that is, they are
+ *  sorted and none is NaN.
+ *
+ * 'std::ranges::is_sorted' is not enough, since comparisons with NaN are all
+ * false: a NaN anywhere passes it and may hide a decrease around it, while the
+ * merge walk never moves back.
+ */
+template<typename Queries>
+bool isMergeable(const Queries& queries) {
+  Index num = std::ranges::ssize(queries);
+  if (num > 0 && !(queries[0] == queries[0])) { return false; }
+
+  for (Index i = 1; i < num; ++i) {
+	if (!(queries[i - 1] <= queries[i])) { return false; }
+  }
+
+  return true;
+}
+
+template<typename Array, typename Queries>
+void mergeSearch(const Array& arr,
+				 const Queries& queries,
+				 VectorX<Index>& out) {
+  Index size = arr.size();
+  Index num = std::ranges::ssize(queries);
+  Index j = 0;
+
+  for (Index i = 0; i < num; ++i) {
+	while (j < size - 1 && !(queries[i] < arr[j + 1])) { ++j; }
+	out[i] = j;
+  }
+}
+
+template<Index lanes = 8, typename Array, typename Queries>
+void interleavedSearch(const Array& arr,
+					   const Queries& queries,
+					   VectorX<Index>& out) {
+  Index size = arr.size();
+  Index num = std::ranges::ssize(queries);
+
+  Index i = 0;
+  for (; i + lanes <= num; i += lanes) {
+	Index begin[lanes] = {};
+
+	// Keep 'lanes' independent searches in flight to overlap their loads
+	for (Index len = size; len > 1; len -= len / 2) {
+	  Index half = len / 2;
+	  for (Index k = 0; k < lanes; ++k) {
+		begin[k] += bchoice<Index>(!(queries[i + k] < arr[begin[k] + half]), half, 0);
+	  }
+	}
+
+	for (Index k = 0; k < lanes; ++k) { out[i + k] = begin[k]; }
+  }
+
+  for (; i < num; ++i) { out[i] = binarySearch(arr, queries[i]); }
+}
+
+template<Index block = 1024, typename Array, typename Keys>
+void blockedSearch(const Array& arr,
+				   const Keys& keys,
+				   VectorX<Index>& out) {
+  Index size = arr.size();
+  Index num = std::ranges::ssize(keys);
+  Index remaining = num;
+
+  // Scan every key over a block while it is still in cache
+  for (Index begin = 0; begin < size && remaining > 0; begin += block) {
+	Index len = min(block, size - begin);
+
+	for (Index j = 0; j < num; ++j) {
+	  if (out[j] != size) { continue; }
+
+	  Index i = simdSearch(arr.data() + begin, len, keys[j]);
+	  if (i < len) {
+		out[j] = begin + i;
+		--remaining;
+	  }
+	}
+  }
+}
+
+template<typename Array, typename Keys>
+void sortedKeySearch(const Array& arr,
+					 const Keys& keys,
+					 VectorX<Index>& out) {
+  using Scalar = std::ranges::range_value_t<Keys>;
+
+  Index size = arr.size();
+
+  // NaN keys are never found and would break the ordering
+  Index num = std::ranges::ssize(keys);
+
+  VectorT<Index> order;
+  order.reserve(num);
+  for (Index j = 0; j < num; ++j) {
+	if (keys[j] == keys[j]) { order.push_back(j); }
+  }
+
+  std::sort(order.begin(), order.end(),
+			[&keys](Index a, Index b) { return keys[a] < keys[b]; });
+
+  VectorT<Scalar> sorted(order.size());
+  for (size_t j = 0; j < order.size(); ++j) { sorted[j] = keys[order[j]]; }
+
+  Index remaining = static_cast<Index>(order.size());
+  for (Index i = 0; i < size && remaining > 0; ++i) {
+	auto it = std::lower_bound(sorted.begin(), sorted.end(), arr[i]);
+
+	for (; it != sorted.end() && !(arr[i] < *it); ++it) {
+	  Index j = order[it - sorted.begin()];
+	  if (out[j] == size) {
+		out[j] = i;
+		--remaining;
+	  }
+	}
+  }
+}
+
 } // namespace internal
 
+/**
+ * @brief Find the interval of a sorted array containing a value.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param arr Sorted array to search, referenced without a copy. Must not be
+ *  empty.
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'arr[i] <= val < arr[i + 1]', clamped to the
+ *  bounds of the array.
+ */
 template<typename Scalar>
-Index SearchSorted(const VectorX<Scalar>& arr, Scalar val) {
+Index SearchSorted(const std::type_identity_t<VectorRef<Scalar>>& arr, Scalar val) {
   assert((arr.size() > 0) && "Array must not be empty");
 
-  if (arr.size() > 64) { return internal::skiplistSearch(arr, val); }
+  // One-shot queries do not amortize any auxiliary structure, see SortedIndex
+  if (arr.size() > 64) { return internal::binarySearch(arr, val); }
 
   return internal::linearSortedSearch(arr, val);
 }
 
+/**
+ * @brief Find the intervals of a sorted array containing each query point.
+ *
+ * Sorted queries without NaN are located with a single merge pass over the
+ * array when that is cheaper than searching each of them, otherwise several
+ * branchless binary searches are interleaved to hide memory latency.
+ *
+ * @tparam Queries Random-access range of values, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView'.
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param arr Sorted array to search, referenced without a copy. Must not be
+ *  empty.
+ * @param queries Values to search for.
+ * @param out Indexes 'i' such that 'arr[i] <= queries[j] < arr[i + 1]',
+ *  clamped to the bounds of the array. Resized to the number of queries.
+ */
+template<std::ranges::random_access_range Queries,
+		 typename Scalar = std::ranges::range_value_t<Queries>>
+requires std::ranges::sized_range<Queries>
+void SearchSorted(const std::type_identity_t<VectorRef<Scalar>>& arr,
+				  const Queries& queries,
+				  VectorX<Index>& out) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  Index size = arr.size();
+  Index num = std::ranges::ssize(queries);
+  out.resize(num);
+
+  bool merge = num * static_cast<Index>(log2(size) + 1) >= size + num;
+
+  if (merge && internal::isMergeable(queries)) {
+	internal::mergeSearch(arr, queries, out);
+  } else {
+	internal::interleavedSearch(arr, queries, out);
+  }
+}
+
+/**
+ * @brief Find the first occurrence of a value in an unsorted array.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param arr Array to search, referenced without a copy. Must not be empty.
+ * @param val Value to search for.
+ *
+ * @return Index of the first element equal to 'val', or the size of the array
+ *  if there is none.
+ */
 template<typename Scalar>
-Index SearchUnsorted(const VectorX<Scalar>& arr, Scalar val) {
+Index SearchUnsorted(const std::type_identity_t<VectorRef<Scalar>>& arr, Scalar val) {
   assert((arr.size() > 0) && "Array must not be empty");
 
-  return internal::linearSearch<Scalar>(arr, val);
+  return internal::simdSearch(arr.data(), arr.size(), val);
+}
+
+/**
+ * @brief Find the first occurrence of each key in an unsorted array.
+ *
+ * The array is traversed once for the whole batch of keys. Few keys are
+ * compared against cache-sized blocks of the array with SIMD instructions,
+ * while many keys are sorted once and every element is looked up among them.
+ *
+ * @tparam Keys Random-access range of values, such as a 'VectorX'.
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param arr Array to search, referenced without a copy. Must not be empty.
+ * @param keys Values to search for.
+ * @param out Index of the first element equal to each key, or the size of
+ *  the array if there is none. Resized to the number of keys.
+ */
+template<std::ranges::random_access_range Keys,
+		 typename Scalar = std::ranges::range_value_t<Keys>>
+requires std::ranges::sized_range<Keys>
+void SearchUnsorted(const std::type_identity_t<VectorRef<Scalar>>& arr,
+					const Keys& keys,
+					VectorX<Index>& out) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  Index num = std::ranges::ssize(keys);
+  out.setConstant(num, arr.size());
+
+  if (num <= 16) {
+	internal::blockedSearch(arr, keys, out);
+  } else {
+	internal::sortedKeySearch(arr, keys, out);
+  }
 }
 
 } // namespace nuenv
@@ -0,0 +1,253 @@
+#ifndef NUENV_ALGORITHM_SIMDSEARCH_H_
+#define NUENV_ALGORITHM_SIMDSEARCH_H_
+
+#include "nuenv/src/core/ctypes.hpp"
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace nuenv {
+
+namespace internal {
+
+/**
+ * @brief Equality comparison of 'kWidth' consecutive elements at once.
+ *
+ * The generic version compares element by element without branches, so the
+ * compiler may still vectorize it. The specializations below use SSE2, AVX2
+ * or AVX-512, whichever is the widest enabled for the target.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+struct PacketEq {
+  static constexpr Index kWidth = 8;
+
+  using Packet = Scalar;
+
+  static Packet set1(Scalar val) { return val; }
+
+  static uint64_t mask(const Scalar* data, Packet val) {
+	uint64_t m = 0;
+	for (Index k = 0; k < kWidth; ++k) {
+	  m |= static_cast<uint64_t>(data[k] == val) << k;
+	}
+
+	return m;
+  }
+};
+
+#if defined(__AVX512F__)
+
+template<>
+struct PacketEq<float> {
+  static constexpr Index kWidth = 16;
+
+  using Packet = __m512;
+
+  static Packet set1(float val) { return _mm512_set1_ps(val); }
+
+  static uint64_t mask(const float* data, Packet val) {
+	return _mm512_cmp_ps_mask(_mm512_loadu_ps(data), val, _CMP_EQ_OQ);
+  }
+};
+
+template<>
+struct PacketEq<double> {
+  static constexpr Index kWidth = 8;
+
+  using Packet = __m512d;
+
+  static Packet set1(double val) { return _mm512_set1_pd(val); }
+
+  static uint64_t mask(const double* data, Packet val) {
+	return _mm512_cmp_pd_mask(_mm512_loadu_pd(data), val, _CMP_EQ_OQ);
+  }
+};
+
+template<>
+struct PacketEq<int32_t> {
+  static constexpr Index kWidth = 16;
+
+  using Packet = __m512i;
+
+  static Packet set1(int32_t val) { return _mm512_set1_epi32(val); }
+
+  static uint64_t mask(const int32_t* data, Packet val) {
+	return _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data), val);
+  }
+};
+
+template<>
+struct PacketEq<int64_t> {
+  static constexpr Index kWidth = 8;
+
+  using Packet = __m512i;
+
+  static Packet set1(int64_t val) { return _mm512_set1_epi64(val); }
+
+  static uint64_t mask(const int64_t* data, Packet val) {
+	return _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(data), val);
+  }
+};
+
+#elif defined(__AVX2__)
+
+template<>
+struct PacketEq<float> {
+  static constexpr Index kWidth = 8;
+
+  using Packet = __m256;
+
+  static Packet set1(float val) { return _mm256_set1_ps(val); }
+
+  static uint64_t mask(const float* data, Packet val) {
+	__m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(data), val, _CMP_EQ_OQ);
+	return static_cast<uint32_t>(_mm256_movemask_ps(eq));
+  }
+};
+
+template<>
+struct PacketEq<double> {
+  static constexpr Index kWidth = 4;
+
+  using Packet = __m256d;
+
+  static Packet set1(double val) { return _mm256_set1_pd(val); }
+
+  static uint64_t mask(const double* data, Packet val) {
+	__m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(data), val, _CMP_EQ_OQ);
+	return static_cast<uint32_t>(_mm256_movemask_pd(eq));
+  }
+};
+
+template<>
+struct PacketEq<int32_t> {
+  static constexpr Index kWidth = 8;
+
+  using Packet = __m256i;
+
+  static Packet set1(int32_t val) { return _mm256_set1_epi32(val); }
+
+  static uint64_t mask(const int32_t* data, Packet val) {
+	__m256i arr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+	__m256i eq = _mm256_cmpeq_epi32(arr, val);
+	return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+  }
+};
+
+template<>
+struct PacketEq<int64_t> {
+  static constexpr Index kWidth = 4;
+
+  using Packet = __m256i;
+
+  static Packet set1(int64_t val) { return _mm256_set1_epi64x(val); }
+
+  static uint64_t mask(const int64_t* data, Packet val) {
+	__m256i arr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+	__m256i eq = _mm256_cmpeq_epi64(arr, val);
+	return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)));
+  }
+};
+
+#elif defined(__SSE2__)
+
+template<>
+struct PacketEq<float> {
+  static constexpr Index kWidth = 4;
+
+  using Packet = __m128;
+
+  static Packet set1(float val) { return _mm_set1_ps(val); }
+
+  static uint64_t mask(const float* data, Packet val) {
+	__m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(data), val);
+	return static_cast<uint32_t>(_mm_movemask_ps(eq));
+  }
+};
+
+template<>
+struct PacketEq<double> {
+  static constexpr Index kWidth = 2;
+
+  using Packet = __m128d;
+
+  static Packet set1(double val) { return _mm_set1_pd(val); }
+
+  static uint64_t mask(const double* data, Packet val) {
+	__m128d eq = _mm_cmpeq_pd(_mm_loadu_pd(data), val);
+	return static_cast<uint32_t>(_mm_movemask_pd(eq));
+  }
+};
+
+template<>
+struct PacketEq<int32_t> {
+  static constexpr Index kWidth = 4;
+
+  using Packet = __m128i;
+
+  static Packet set1(int32_t val) { return _mm_set1_epi32(val); }
+
+  static uint64_t mask(const int32_t* data, Packet val) {
+	__m128i arr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+	__m128i eq = _mm_cmpeq_epi32(arr, val);
+	return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+  }
+};
+
+#endif
+
+/**
+ * @brief Find the first element of an array equal to a value, comparing
+ *  several elements per instruction.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param data Pointer to the first element of the array.
+ * @param size Number of elements of the array.
+ * @param val Value to search for.
+ *
+ * @return Index of the first element equal to 'val', or 'size' if there is
+ *  none.
+ */
+template<typename Scalar>
+Index simdSearch(const Scalar* data, Index size, Scalar val) {
+  using Eq = PacketEq<Scalar>;
+  constexpr Index width = Eq::kWidth;
+
+  const typename Eq::Packet packet = Eq::set1(val);
+
+  Index i = 0;
+
+  // Four packets per iteration, merging their masks so that there is a single
+  // branch per iteration
+  for (; i + 4 * width <= size; i += 4 * width) {
+	uint64_t m = Eq::mask(data + i, packet)
+		| Eq::mask(data + i + width, packet) << width
+		| Eq::mask(data + i + 2 * width, packet) << (2 * width)
+		| Eq::mask(data + i + 3 * width, packet) << (3 * width);
+	if (m != 0) { return i + std::countr_zero(m); }
+  }
+
+  for (; i + width <= size; i += width) {
+	uint64_t m = Eq::mask(data + i, packet);
+	if (m != 0) { return i + std::countr_zero(m); }
+  }
+
+  for (; i < size; ++i) {
+	if (data[i] == val) { return i; }
+  }
+
+  return size;
+}
+
+} // namespace internal
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef NUENV_ALGORITHM_SORTEDINDEX_H_
+#define NUENV_ALGORITHM_SORTEDINDEX_H_
+
+#include "nuenv/src/algorithm/grid.hpp"
+#include "nuenv/src/algorithm/learned_index.hpp"
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <optional>
+#include <ranges>
+#include <type_traits>
+
+namespace nuenv {
+
+/**
+ * @class SortedIndex
+ *
+ * @brief Reusable search index over a sorted array.
+ *
+ * Builds the auxiliary structures used to accelerate 'SearchSorted' once, so
+ * that repeated queries against the same array do not allocate or rebuild
+ * them. The index holds a reference to the data, which must outlive it and
+ * must not be modified while the index is in use. The data may also be caller
+ * memory viewed through a 'VectorView', so that it is indexed without a copy.
+ *
+ * Arrays that are (nearly) evenly spaced on a linear or log scale, such as
+ * those generated by 'LinearSpace', 'LogarithmicSpace' or 'geometricSpace',
+ * are detected on construction and searched in constant time. For other
+ * large arrays a 'LearnedIndex' is also built, and kept in place of the skip
+ * list if its model is small enough that a search costs fewer probes than a
+ * 'binarySearch' over the whole array. The choice depends only on the data,
+ * so it is the same on every run and every machine.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam skip Distance between consecutive entries of the skip list.
+ */
+template<typename Scalar, Index skip = 8>
+class SortedIndex {
+ public:
+  explicit SortedIndex(const VectorX<Scalar>& arr);
+
+  explicit SortedIndex(VectorView<Scalar> arr);
+
+  SortedIndex(const VectorX<Scalar>&& arr) = delete;
+
+  Index search(Scalar val) const;
+
+  template<std::ranges::random_access_range Queries>
+  requires std::ranges::sized_range<Queries>
+  void search(const Queries& queries, VectorX<Index>& out) const;
+
+  VectorView<Scalar> data() const;
+
+  Index size() const;
+
+ private:
+  enum class Method { Linear, Skiplist, Uniform, Logarithmic, Learned };
+
+  static constexpr Index kLinearMaxSize = 64;
+
+  static constexpr Index kLearnedMinSize = 4096;
+
+  // Cost of evaluating the model of the learned index, in probes
+  static constexpr double kModelProbes = 2.0;
+
+  const Scalar* data_;
+  Index size_;
+  Method method_;
+  VectorX<Scalar> skplst_;
+  std::optional<LearnedIndex<Scalar>> learned_;
+  Scalar origin_;
+  Scalar inv_step_;
+};
+
+/**
+ * Constructs the index.
+ *
+ * @param arr Sorted array to be indexed. Must not be empty.
+ */
+template<typename Scalar, Index skip>
+SortedIndex<Scalar, skip>::SortedIndex(const VectorX<Scalar>& arr)
+	: SortedIndex(VectorView<Scalar>(arr.data(), arr.size())) {}
+
+/**
+ * Constructs the index over a view.
+ *
+ * @param arr Sorted array to be indexed. Must not be empty.
+ */
+template<typename Scalar, Index skip>
+SortedIndex<Scalar, skip>::SortedIndex(VectorView<Scalar> arr)
+	: data_(arr.data()),
+	  size_(arr.size()),
+	  method_(Method::Linear),
+	  origin_(0),
+	  inv_step_(0) {
+  assert((arr.size() > 0) && "Array must not be empty");
+
+  Index size = arr.size();
+
+  if constexpr (std::is_floating_point_v<Scalar>) {
+	if (IsUniform(arr)) {
+	  method_ = Method::Uniform;
+	  origin_ = arr[0];
+	  inv_step_ = static_cast<Scalar>(size - 1) / (arr[size - 1] - arr[0]);
+	  return;
+	}
+
+	// The logarithm only pays off against a longer search
+	if (size > kLinearMaxSize && IsLogUniform(arr)) {
+	  method_ = Method::Logarithmic;
+	  origin_ = log2(arr[0]);
+	  inv_step_ = static_cast<Scalar>(size - 1) / (log2(arr[size - 1]) - origin_);
+	  return;
+	}
+  }
+
+  if (size <= kLinearMaxSize) { return; }
+
+  method_ = Method::Skiplist;
+  size = arr.size() / skip;
+  skplst_.resize(size);
+  for (Index i = 0; i < size; ++i) {
+	skplst_[i] = arr[skip * i];
+  }
+
+  if (arr.size() < kLearnedMinSize) { return; }
+
+  LearnedIndex<Scalar> learned(arr);
+
+  // Probes over the segments and then within the error window, against those
+  // of a binary search over the whole array
+  double probes_learned = log2(static_cast<double>(learned.segments()))
+	  + log2(static_cast<double>(LearnedIndex<Scalar>::kWindow)) + kModelProbes;
+  double probes_binary = log2(static_cast<double>(arr.size()));
+
+  if (probes_learned < probes_binary) {
+	method_ = Method::Learned;
+	learned_.emplace(learned);
+	skplst_.resize(0);
+  }
+}
+
+/**
+ * @brief Find the interval of the indexed array containing a value.
+ *
+ * Does not allocate.
+ *
+ * @param val Value to search for.
+ *
+ * @return Index 'i' such that 'arr[i] <= val < arr[i + 1]', clamped to the
+ *  bounds of the array.
+ */
+template<typename Scalar, Index skip>
+Index SortedIndex<Scalar, skip>::search(Scalar val) const {
+  const VectorView<Scalar> arr = data();
+  Index size = size_;
+
+  switch (method_) {
+	case Method::Uniform: {
+	  Index i = internal::gridCell((val - origin_) * inv_step_, size);
+	  return internal::gridCorrect(arr, size, val, i);
+	}
+	case Method::Logarithmic: {
+	  // Non-positive values have no log, NaN still goes to the last cell
+	  if (val <= arr[0]) { return 0; }
+
+	  Index i = internal::gridCell((log2(val) - origin_) * inv_step_, size);
+	  return internal::gridCorrect(arr, size, val, i);
+	}
+	case Method::Skiplist:
+	  return internal::skiplistSearch<Scalar, skip>(arr, skplst_, val);
+	case Method::Learned:
+	  return learned_->search(val);
+	default:
+	  return internal::linearSortedSearch(arr, val);
+  }
+}
+
+/**
+ * @brief Find the intervals of the indexed array containing each query point.
+ *
+ * Arrays searched in constant time are queried point by point. Otherwise
+ * sorted queries without NaN are walked over the array in a single merge pass
+ * when that is cheaper than searching each of them, and the remaining ones
+ * fall back to the learned index or to the batched 'SearchSorted'.
+ *
+ * @tparam Queries Random-access range of values.
+ *
+ * @param queries Values to search for.
+ * @param out Indexes 'i' such that 'arr[i] <= queries[j] < arr[i + 1]',
+ *  clamped to the bounds of the array. Resized to the number of queries.
+ */
+template<typename Scalar, Index skip>
+template<std::ranges::random_access_range Queries>
+requires std::ranges::sized_range<Queries>
+void SortedIndex<Scalar, skip>::search(const Queries& queries,
+									   VectorX<Index>& out) const {
+  Index size = size_;
+  Index num = std::ranges::ssize(queries);
+  out.resize(num);
+
+  bool constant = method_ == Method::Uniform || method_ == Method::Logarithmic;
+  bool merge = num * static_cast<Index>(log2(size) + 1) >= size + num;
+
+  if (!constant && merge && internal::isMergeable(queries)) {
+	internal::mergeSearch(data(), queries, out);
+  } else if (constant || method_ == Method::Learned) {
+	for (Index i = 0; i < num; ++i) { out[i] = search(queries[i]); }
+  } else {
+	internal::interleavedSearch(data(), queries, out);
+  }
+}
+
+/**
+ * @brief View of the indexed array.
+ */
+template<typename Scalar, Index skip>
+VectorView<Scalar> SortedIndex<Scalar, skip>::data() const {
+  return {data_, size_};
+}
+
+/**
+ * @brief Number of elements of the indexed array.
+ */
+template<typename Scalar, Index skip>
+Index SortedIndex<Scalar, skip>::size() const {
+  return size_;
+}
+
+template<typename Scalar, Index skip>
+Index SearchSorted(const SortedIndex<Scalar, skip>& index, Scalar val) {
+  return index.search(val);
+}
+
+template<typename Scalar, Index skip, std::ranges::random_access_range Queries>
+requires std::ranges::sized_range<Queries>
+void SearchSorted(const SortedIndex<Scalar, skip>& index,
+				  const Queries& queries,
+				  VectorX<Index>& out) {
+  index.search(queries, out);
+}
+
+} // namespace nuenv
+
+#endif
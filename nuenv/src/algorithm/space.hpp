@@ -5,8 +5,38 @@
 #include "nuenv/src/core/ctypes.hpp"
 #include "nuenv/src/core/math.hpp"
 
+#include <ranges>
+
 namespace nuenv {
 
+namespace internal {
+
+/**
+ * @brief Raise 2 to the power of each element of an array, in place, using
+ *  vectorized arithmetic.
+ *
+ * Each exponent is split as 't = n + f', with integer 'n' and '|f| <= 1/2', so
+ * that the vectorized 'exp' only sees small arguments and '2^n' is applied
+ * exactly afterwards. Each result is within 2 ULP of 'exp2(t)' for the
+ * exponent 't' as stored. Since 't' is itself rounded, the error against the
+ * exact power grows by roughly '|t| * epsilon' relative.
+ *
+ * @param arr Exponents, overwritten with the powers of 2.
+ */
+template<typename Derived>
+void exp2InPlace(Eigen::MatrixBase<Derived>& arr) {
+  using Scalar = typename Derived::Scalar;
+
+  const typename Derived::PlainObject n = arr.array().round();
+  arr = ((arr - n).array() * ln2_v<Scalar>).exp().matrix();
+
+  for (Index i = 0; i < arr.size(); i++) {
+	arr[i] = ldexp(arr[i], static_cast<int>(n[i]));
+  }
+}
+
+} // namespace internal
+
 /**
  * @brief Generate an array with evenly spaced scalars over a specified interval.
  *
@@ -23,10 +53,32 @@ VectorX<Scalar> LinearSpace(Scalar start, Scalar stop, Index num) {
   return VectorX<Scalar>::LinSpaced(num, start, stop);
 }
 
+/**
+ * @brief Generate a fixed-size array with evenly spaced scalars over a
+ *  specified interval.
+ *
+ * @tparam num Number of samples to generate.
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence.
+ * @param stop End value of the sequence.
+ *
+ * @return Array of evenly spaced scalars.
+ */
+template<size_t num, typename Scalar>
+VectorX_s<Scalar, num> LinearSpace(Scalar start, Scalar stop) {
+  return VectorX_s<Scalar, num>::LinSpaced(start, stop);
+}
+
 /**
  * @brief Generate an array with evenly spaced scalars on a log scale over a
  *  specified interval.
  *
+ * The powers are computed with vectorized arithmetic, each within 2 ULP of
+ * 'exp2' of the evenly spaced exponent 't' as rounded. The error against the
+ * exact power is larger by roughly '|t| * epsilon' relative, with 't' the
+ * base-2 log of the value.
+ *
  * @tparam Scalar Scalar type of the numbers.
  *
  * @param start Starting value of the sequence. Must be positive.
@@ -39,17 +91,34 @@ template<typename Scalar>
 VectorX<Scalar> LogarithmicSpace(Scalar start, Scalar stop, Index num) {
   assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
 
-  constexpr Scalar base = 2.0;
+  VectorX<Scalar> arr = LinearSpace(log2(start), log2(stop), num);
+  internal::exp2InPlace(arr);
+
+  // Returns with copy elision
+  return arr;
+}
 
-  Scalar a_log = log(start) / log(base);
-  Scalar b_log = log(stop) / log(base);
-  VectorX<Scalar> arr = LinearSpace(a_log, b_log, num);
+/**
+ * @brief Generate a fixed-size array with evenly spaced scalars on a log
+ *  scale over a specified interval.
+ *
+ * See 'LogarithmicSpace' for the accuracy of the powers.
+ *
+ * @tparam num Number of samples to generate.
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence. Must be positive.
+ *
+ * @return Array of evenly spaced scalars.
+ */
+template<size_t num, typename Scalar>
+VectorX_s<Scalar, num> LogarithmicSpace(Scalar start, Scalar stop) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
 
-  for (Index i = 0; i < num; i++) {
-	arr[i] = pow(base, arr[i]);
-  }
+  VectorX_s<Scalar, num> arr = LinearSpace<num>(log2(start), log2(stop));
+  internal::exp2InPlace(arr);
 
-  // Returns with copy elision
   return arr;
 }
 
@@ -57,6 +126,12 @@ VectorX<Scalar> LogarithmicSpace(Scalar start, Scalar stop, Index num) {
  * @brief Generate an array with a geometric progression of scalars over a
  *  specified interval.
  *
+ * The progression 'start * r^i' is computed as '2^(log2(start) + i log2(r))'
+ * with vectorized arithmetic, each power within 2 ULP of 'exp2' of its
+ * exponent as rounded. As the exponent accumulates the rounding of 'log2(r)',
+ * the error against the exact progression grows by roughly '|t| * epsilon'
+ * relative for the exponent 't'.
+ *
  * @tparam Scalar Scalar type of the numbers.
  *
  * @param start Starting value of the sequence. Must be positive.
@@ -70,17 +145,124 @@ VectorX<Scalar> geometricSpace(Scalar start, Scalar stop, Index num) {
   assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
 
   Scalar r = pow(stop / start, 1.0 / (static_cast<Scalar>(num) - 1.0));
+  Scalar r_log = num > 1 ? log2(r) : 0.0;
 
-  VectorX<Scalar> arr(num);
-
-  for (Index i = 0; i < num; i++) {
-	arr[i] = start * pow(r, i);
-  }
+  VectorX<Scalar> arr = log2(start)
+	  + r_log * VectorX<Scalar>::LinSpaced(num, 0.0, static_cast<Scalar>(num - 1)).array();
+  internal::exp2InPlace(arr);
 
   // Returns with copy elision
   return arr;
 }
 
+/**
+ * @brief Generate a fixed-size array with a geometric progression of scalars
+ *  over a specified interval.
+ *
+ * See 'geometricSpace' for the accuracy of the progression.
+ *
+ * @tparam num Number of samples to generate.
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence. Must be positive.
+ *
+ * @return Array of scalars in geometric progression.
+ */
+template<size_t num, typename Scalar>
+VectorX_s<Scalar, num> geometricSpace(Scalar start, Scalar stop) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
+
+  Scalar r = pow(stop / start, 1.0 / (static_cast<Scalar>(num) - 1.0));
+  Scalar r_log = num > 1 ? log2(r) : 0.0;
+
+  VectorX_s<Scalar, num> arr = log2(start)
+	  + r_log * VectorX_s<Scalar, num>::LinSpaced(0.0, static_cast<Scalar>(num - 1)).array();
+  internal::exp2InPlace(arr);
+
+  return arr;
+}
+
+/**
+ * @brief Lazy view of evenly spaced scalars over a specified interval.
+ *
+ * The elements are computed on demand, so no array is allocated. The view is
+ * sized and random-access and composes with 'std::views'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence.
+ * @param stop End value of the sequence.
+ * @param num Number of samples to generate. Must be non-negative.
+ *
+ * @return View of evenly spaced scalars.
+ */
+template<typename Scalar>
+auto LinearSpaceView(Scalar start, Scalar stop, Index num) {
+  Scalar step = num > 1 ? (stop - start) / static_cast<Scalar>(num - 1) : 0.0;
+
+  return std::views::iota(Index {0}, max<Index>(num, 0))
+	  | std::views::transform([=](Index i) -> Scalar {
+		return i == num - 1 ? stop : start + static_cast<Scalar>(i) * step;
+	  });
+}
+
+/**
+ * @brief Lazy view of evenly spaced scalars on a log scale over a specified
+ *  interval.
+ *
+ * The elements are computed on demand, so no array is allocated. The view is
+ * sized and random-access and composes with 'std::views'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence.
+ * @param num Number of samples to generate. Must be non-negative.
+ *
+ * @return View of evenly spaced scalars.
+ */
+template<typename Scalar>
+auto LogarithmicSpaceView(Scalar start, Scalar stop, Index num) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
+
+  Scalar a_log = log2(start);
+  Scalar b_log = log2(stop);
+  Scalar step = num > 1 ? (b_log - a_log) / static_cast<Scalar>(num - 1) : 0.0;
+
+  return std::views::iota(Index {0}, max<Index>(num, 0))
+	  | std::views::transform([=](Index i) -> Scalar {
+		return exp2(i == num - 1 ? b_log : a_log + static_cast<Scalar>(i) * step);
+	  });
+}
+
+/**
+ * @brief Lazy view of a geometric progression of scalars over a specified
+ *  interval.
+ *
+ * The elements are computed on demand, so no array is allocated. The view is
+ * sized and random-access and composes with 'std::views'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param start Starting value of the sequence. Must be positive.
+ * @param stop End value of the sequence.
+ * @param num Number of samples to generate. Must be non-negative.
+ *
+ * @return View of a geometric progression of scalars.
+ */
+template<typename Scalar>
+auto geometricSpaceView(Scalar start, Scalar stop, Index num) {
+  assert((start > 0.0 && stop > 0.0) && "Arguments must not be 0");
+
+  Scalar r = pow(stop / start, 1.0 / (static_cast<Scalar>(num) - 1.0));
+
+  return std::views::iota(Index {0}, max<Index>(num, 0))
+	  | std::views::transform([=](Index i) -> Scalar {
+		return start * pow(r, i);
+	  });
+}
+
 }
 
 #endif
@@ -2,6 +2,9 @@
 #define NUENV_CORE_CONTAINER_H_
 
 #include "Eigen/Dense"
+
+#include <cassert>
+#include <ranges>
 #include <vector>
 
 namespace nuenv {
@@ -24,6 +27,59 @@ using Vector3X = Eigen::Matrix<Scalar, 3, 1>;
 template<typename Scalar>
 using MatrixSQX = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
 
+/**
+ * @brief Row-major matrix, whose rows are contiguous.
+ */
+template<typename Scalar>
+using MatrixRowX = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * @brief Read-only reference to a vector, binding without a copy to any
+ *  vector with contiguous storage, such as 'VectorX', 'VectorX_s', a column
+ *  of a 'MatrixSQX' or a 'VectorView'. Other expressions are evaluated into
+ *  a temporary.
+ */
+template<typename Scalar>
+using VectorRef = Eigen::Ref<const VectorX<Scalar>>;
+
+/**
+ * @brief Read-only reference to a column-major matrix, binding without a copy
+ *  to a 'MatrixSQX' or any block of one, such as a range of its columns.
+ *  Other expressions are evaluated into a temporary.
+ */
+template<typename Scalar>
+using MatrixRef = Eigen::Ref<const MatrixSQX<Scalar>, 0, Eigen::OuterStride<>>;
+
+/**
+ * @brief Read-only, non-owning view of contiguous memory as a vector.
+ *
+ * The memory must outlive the view.
+ */
+template<typename Scalar>
+using VectorView = Eigen::Map<const VectorX<Scalar>>;
+
+/**
+ * @brief View contiguous memory, such as a 'std::vector', 'std::array' or
+ *  'std::span', as a vector without copying it.
+ */
+template<std::ranges::contiguous_range Range>
+requires std::ranges::sized_range<Range>
+VectorView<std::ranges::range_value_t<Range>> AsVector(const Range& range) {
+  return {std::ranges::data(range), static_cast<Eigen::Index>(std::ranges::size(range))};
+}
+
+/**
+ * @brief View an Eigen vector with contiguous storage, such as a column of a
+ *  matrix, without copying it.
+ */
+template<typename Derived>
+requires requires(const Derived& v) { v.data(); }
+VectorView<typename Derived::Scalar> AsVector(const Eigen::DenseBase<Derived>& vector) {
+  assert((vector.derived().innerStride() == 1) && "Vector must be contiguous");
+
+  return {vector.derived().data(), vector.size()};
+}
+
 }
 
 #endif
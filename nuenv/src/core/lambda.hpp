@@ -1,13 +1,94 @@
 #ifndef NUENV_CORE_LAMBDA_H_
 #define NUENV_CORE_LAMBDA_H_
 
+#include <cassert>
+#include <concepts>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace nuenv {
 
 template<typename Signature>
 using Lambda = std::function<Signature>;
 
+/**
+ * @brief Callable with arguments of types 'Args' returning a value convertible
+ *  to 'Result', such as a lambda, a function pointer, a 'Lambda' or a
+ *  'FunctionRef'.
+ *
+ * Taking such callables as template parameters lets the calls be inlined,
+ * where a 'Lambda' costs an indirect call per evaluation.
+ */
+template<typename Func, typename Result, typename... Args>
+concept Callable = std::invocable<const Func&, Args...>
+	&& std::convertible_to<std::invoke_result_t<const Func&, Args...>, Result>;
+
+template<typename Signature>
+class FunctionRef;
+
+/**
+ * @class FunctionRef
+ *
+ * @brief Non-owning, type-erased reference to a callable.
+ *
+ * Unlike 'Lambda', it never allocates and is trivially copyable: it holds a
+ * pointer to the callable and a pointer to a function invoking it. Function
+ * pointers are held by value, and other callables by address, so these must
+ * outlive the reference: it is meant for parameters, not for storage.
+ *
+ * @tparam Result Return type of the callable.
+ * @tparam Args Argument types of the callable.
+ */
+template<typename Result, typename... Args>
+class FunctionRef<Result(Args...)> {
+ public:
+  /**
+   * Constructs a reference to a callable object, such as a lambda.
+   */
+  template<typename Func>
+  requires (!std::is_same_v<std::remove_cvref_t<Func>, FunctionRef>)
+	  && std::is_object_v<std::remove_reference_t<Func>>
+	  && (!std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<Func>>>)
+	  && std::is_invocable_r_v<Result, Func&, Args...>
+  FunctionRef(Func&& func) noexcept
+	  : target_ {.object = const_cast<void*>(static_cast<const void*>(std::addressof(func)))},
+		call_([](Target target, Args... args) -> Result {
+		  return std::invoke(*static_cast<std::add_pointer_t<Func>>(target.object),
+							 std::forward<Args>(args)...);
+		}) {}
+
+  /**
+   * Constructs a reference to a function, copying the function pointer so that
+   * a temporary such as '&func' can be passed.
+   */
+  template<typename Func>
+  requires std::is_function_v<Func> && std::is_invocable_r_v<Result, Func&, Args...>
+  FunctionRef(Func* func) noexcept
+	  : target_ {.function = reinterpret_cast<void (*)()>(func)},
+		call_([](Target target, Args... args) -> Result {
+		  return std::invoke(reinterpret_cast<Func*>(target.function),
+							 std::forward<Args>(args)...);
+		}) {
+	assert(func && "Function must not be null");
+  }
+
+  Result operator()(Args... args) const {
+	return call_(target_, std::forward<Args>(args)...);
+  }
+
+ private:
+  // Address of a callable object, or a function pointer
+  union Target {
+	void* object;
+	void (* function)();
+  };
+
+  Target target_;
+  Result (* call_)(Target, Args...);
+};
+
 }
 
 #endif
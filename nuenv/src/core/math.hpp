@@ -8,6 +8,8 @@ namespace nuenv {
 
 using namespace std::numbers;
 
+using std::abs;
+
 using std::ceil;
 
 using std::min;
@@ -20,6 +22,10 @@ using std::pow;
 
 using std::exp;
 
+using std::exp2;
+
+using std::ldexp;
+
 using std::log;
 
 using std::log2;
@@ -0,0 +1,245 @@
+#ifndef NUENV_CORE_THREADPOOL_H_
+#define NUENV_CORE_THREADPOOL_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/lambda.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace nuenv {
+
+/**
+ * @class ThreadPool
+ *
+ * @brief Pool of worker threads running fork-join tasks with work stealing.
+ *
+ * Each worker owns a queue of tasks. A task submitted from a worker goes to
+ * the back of its own queue, and a worker runs the most recent task of its
+ * own queue first, so that nested subdivisions stay on the thread which made
+ * them. Idle workers steal the oldest task of the other queues, which tends
+ * to be the largest piece of work left.
+ *
+ * Tasks are tracked in groups, and waiting on a group runs pending tasks
+ * until all of those of the group have finished, so that tasks can wait on
+ * tasks of their own without blocking a worker. Tasks must not throw.
+ */
+class ThreadPool {
+ public:
+  using Task = Lambda<void()>;
+
+  /**
+   * @brief Set of tasks to be waited on together.
+   */
+  class Group {
+   public:
+	Group() = default;
+
+	Group(const Group&) = delete;
+
+	Group& operator=(const Group&) = delete;
+
+   private:
+	friend class ThreadPool;
+
+	std::atomic<Index> pending_ {0};
+  };
+
+  explicit ThreadPool(Index threads = 0);
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool();
+
+  Index size() const;
+
+  void submit(Group& group, Task task);
+
+  void wait(Group& group);
+
+ private:
+  struct Queue {
+	std::mutex mutex;
+	std::deque<std::pair<Group*, Task>> tasks;
+  };
+
+  Index self() const;
+
+  bool runOne(Index self);
+
+  void work(Index self);
+
+  std::unique_ptr<Queue[]> queues_;
+  VectorT<std::thread> workers_;
+
+  std::atomic<Index> queued_ {0};
+  std::atomic<Index> next_ {0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+
+  // Pool and queue of the worker running on this thread, if any
+  static inline thread_local const ThreadPool* current_pool_ = nullptr;
+  static inline thread_local Index current_queue_ = 0;
+};
+
+/**
+ * Constructs the pool and starts its workers.
+ *
+ * @param threads Number of worker threads. Default is 0, that is, one per
+ *  hardware thread.
+ */
+inline ThreadPool::ThreadPool(Index threads) {
+  if (threads <= 0) {
+	threads = max<Index>(static_cast<Index>(std::thread::hardware_concurrency()), 1);
+  }
+
+  queues_ = std::make_unique<Queue[]>(threads);
+
+  workers_.reserve(threads);
+  for (Index i = 0; i < threads; i++) {
+	workers_.emplace_back([this, i]() { work(i); });
+  }
+}
+
+/**
+ * @brief Destructor.
+ *
+ * Runs the tasks still queued and joins the workers.
+ */
+inline ThreadPool::~ThreadPool() {
+  {
+	std::lock_guard<std::mutex> lock(sleep_mutex_);
+	stop_ = true;
+  }
+  wake_.notify_all();
+
+  for (std::thread& worker : workers_) { worker.join(); }
+}
+
+/**
+ * @brief Number of worker threads.
+ */
+inline Index ThreadPool::size() const {
+  return static_cast<Index>(workers_.size());
+}
+
+/**
+ * @brief Queue a task.
+ *
+ * From a worker of the pool, the task goes to the queue of that worker, and
+ * otherwise to the queues in turn.
+ *
+ * @param group Group of the task, which must outlive it.
+ * @param task Task to run.
+ */
+inline void ThreadPool::submit(Group& group, Task task) {
+  group.pending_.fetch_add(1, std::memory_order_relaxed);
+
+  Index i = self();
+  if (i < 0) { i = next_.fetch_add(1, std::memory_order_relaxed) % size(); }
+
+  {
+	std::lock_guard<std::mutex> lock(queues_[i].mutex);
+	queues_[i].tasks.emplace_back(&group, std::move(task));
+  }
+
+  // Counted under the lock the workers sleep on, so none misses the wake-up
+  {
+	std::lock_guard<std::mutex> lock(sleep_mutex_);
+	queued_.fetch_add(1, std::memory_order_relaxed);
+  }
+  wake_.notify_one();
+}
+
+/**
+ * @brief Wait for all the tasks of a group to finish, running queued tasks
+ *  in the meantime.
+ *
+ * @param group Group to wait on.
+ */
+inline void ThreadPool::wait(Group& group) {
+  const Index i = self();
+
+  while (group.pending_.load(std::memory_order_acquire) > 0) {
+	if (!runOne(i)) { std::this_thread::yield(); }
+  }
+}
+
+/**
+ * @brief Queue of the worker running on the calling thread, or -1 outside the
+ *  pool.
+ */
+inline Index ThreadPool::self() const {
+  return current_pool_ == this ? current_queue_ : -1;
+}
+
+/**
+ * @brief Run a single queued task, the most recent of queue 'self' if any, or
+ *  else the oldest of another queue.
+ *
+ * @param self Queue of the calling worker, or -1 outside the pool.
+ *
+ * @return Whether a task was run.
+ */
+inline bool ThreadPool::runOne(Index self) {
+  std::pair<Group*, Task> task {nullptr, nullptr};
+
+  if (self >= 0) {
+	std::lock_guard<std::mutex> lock(queues_[self].mutex);
+	if (!queues_[self].tasks.empty()) {
+	  task = std::move(queues_[self].tasks.back());
+	  queues_[self].tasks.pop_back();
+	}
+  }
+
+  // Steal, starting from the next queue so thieves spread out
+  const Index num = size();
+  const Index start = self >= 0 ? self + 1 : next_.load(std::memory_order_relaxed);
+  for (Index k = 0; !task.first && k < num; k++) {
+	Queue& queue = queues_[(start + k) % num];
+
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (!queue.tasks.empty()) {
+	  task = std::move(queue.tasks.front());
+	  queue.tasks.pop_front();
+	}
+  }
+
+  if (!task.first) { return false; }
+
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  task.second();
+  task.first->pending_.fetch_sub(1, std::memory_order_release);
+
+  return true;
+}
+
+/**
+ * @brief Loop of a worker, sleeping while there is nothing to run.
+ */
+inline void ThreadPool::work(Index self) {
+  current_pool_ = this;
+  current_queue_ = self;
+
+  while (true) {
+	if (runOne(self)) { continue; }
+
+	std::unique_lock<std::mutex> lock(sleep_mutex_);
+	wake_.wait(lock, [this]() { return stop_ || queued_.load(std::memory_order_relaxed) > 0; });
+	if (stop_ && queued_.load(std::memory_order_relaxed) == 0) { return; }
+  }
+}
+
+} // namespace nuenv
+
+#endif
@@ -17,7 +17,7 @@ namespace nuenv {
  */
 template<typename Scalar, typename ScalarField>
 struct OdeSolution {
-  OdeSolution(const VectorX<Scalar>& _t,
+  OdeSolution(const VectorRef<Scalar>& _t,
 			  const VectorX<ScalarField>& _x,
 			  const size_t _size)
 	  : t(_t), x(_x), size(_size) {}
@@ -38,7 +38,8 @@ class OdeSolver {
    * It provides an interface to different solvers that implement the
    * 'Solver' interface.
    *
-   * @param t_eval Time values at which to evaluate the solution.
+   * @param t_eval Time values at which to evaluate the solution, referenced
+   *  without a copy.
    * @param x0 Initial state.
    * @param stopEvent Lambda function that returns 'true' if an event
    *  to stop the solver has occurred, 'false' otherwise.
@@ -46,7 +47,7 @@ class OdeSolver {
    * @return Solution to the differential equation at the specified times.
    */
   virtual OdeSolution<Scalar, ScalarField> solve(
-	  const VectorX<Scalar>& t_eval,
+	  const VectorRef<Scalar>& t_eval,
 	  ScalarField x0,
 	  Lambda<bool(ScalarField)> stopEvent) = 0;
 
@@ -3,8 +3,35 @@
 
 #include "nuenv/core"
 
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
+
 namespace nuenv {
 
+/**
+ * @brief Integrand evaluated at many nodes in one call.
+ *
+ * It takes the nodes as a vector and returns a vector with the values of the
+ * integrand at each of them, in the same order. Evaluating a whole panel, or
+ * many panels, in one call lets the integrand vectorize its arithmetic and
+ * amortize any per-call overhead. The batch quadratures take any callable of
+ * this signature, this type being its type-erased form.
+ */
+template<typename Scalar>
+using BatchIntegrand = Lambda<VectorX<Scalar>(const VectorX<Scalar>&)>;
+
+/**
+ * @brief Integrand returning a vector, such as a 'VectorX', a 'VectorX_s', a
+ *  column 'Eigen::Array' or any Eigen vector expression, to integrate all its
+ *  components at once.
+ */
+template<typename Func, typename Scalar>
+concept VectorIntegrand = std::invocable<const Func&, Scalar>
+	&& std::derived_from<std::remove_cvref_t<std::invoke_result_t<const Func&, Scalar>>,
+						 Eigen::DenseBase<std::remove_cvref_t<std::invoke_result_t<const Func&, Scalar>>>>
+	&& (std::remove_cvref_t<std::invoke_result_t<const Func&, Scalar>>::ColsAtCompileTime == 1);
+
 namespace internal {
 
 template<typename Scalar>
@@ -100,6 +127,344 @@ const VectorX_s<Scalar, ConstsG10K21<Scalar>::kNk> ConstsG10K21<Scalar>::kXk =
 		9.956571630258080807355272806890028e-01
 	};
 
+template<typename Scalar, Index n>
+struct ConstsGaussLegendre;
+
+template<typename Scalar>
+struct ConstsGaussLegendre<Scalar, 2> {
+  static const VectorX_s<Scalar, 2> kW;
+  static const VectorX_s<Scalar, 2> kX;
+};
+
+template<typename Scalar>
+const VectorX_s<Scalar, 2> ConstsGaussLegendre<Scalar, 2>::kW = {1.0, 1.0};
+
+template<typename Scalar>
+const VectorX_s<Scalar, 2> ConstsGaussLegendre<Scalar, 2>::kX = {-0.5773502692, 0.5773502692};
+
+template<typename Scalar>
+struct ConstsGaussLegendre<Scalar, 3> {
+  static const VectorX_s<Scalar, 3> kW;
+  static const VectorX_s<Scalar, 3> kX;
+};
+
+template<typename Scalar>
+const VectorX_s<Scalar, 3> ConstsGaussLegendre<Scalar, 3>::kW =
+	{
+		0.5555555556,
+		0.8888888889,
+		0.5555555556
+	};
+
+template<typename Scalar>
+const VectorX_s<Scalar, 3> ConstsGaussLegendre<Scalar, 3>::kX =
+	{
+		-0.7745966692,
+		0.0,
+		0.7745966692
+	};
+
+/**
+ * @brief Apply a Gauss-Legendre rule on '[a, b]' with a single evaluation of
+ *  the integrand at all its nodes.
+ *
+ * @param x Nodes of the rule on '[-1, 1]'.
+ * @param w Weights of the rule.
+ */
+template<typename Scalar, typename Func, typename Derived>
+Scalar gaussLegendre(const Func& func,
+					 Scalar a,
+					 Scalar b,
+					 const Eigen::MatrixBase<Derived>& x,
+					 const Eigen::MatrixBase<Derived>& w) {
+  VectorX<Scalar> nodes = (((b - a) * x.array() + (b + a)) / 2.0).matrix();
+
+  const VectorX<Scalar> values = func(nodes);
+  assert((values.size() == nodes.size()) && "Integrand must return one value per node");
+
+  return w.dot(values) * (b - a) / 2.0;
+}
+
+/**
+ * @brief Subinterval of an adaptive quadrature with its estimates.
+ */
+template<typename Scalar, typename Value = Scalar>
+struct QuadratureInterval {
+  Scalar a;
+  Scalar b;
+  Value integral;
+  Scalar error;
+};
+
+/**
+ * @brief Type of the integral of a vector-valued integrand.
+ */
+template<typename Func, typename Scalar>
+using VectorIntegral = typename std::remove_cvref_t<std::invoke_result_t<const Func&, Scalar>>::PlainObject;
+
+/**
+ * @brief Norm of an integral, its absolute value for scalars and its maximum
+ *  norm for vectors.
+ */
+template<typename Value>
+auto quadratureNorm(const Value& value) {
+  if constexpr (std::is_base_of_v<Eigen::DenseBase<Value>, Value>) {
+	return value.matrix().template lpNorm<Eigen::Infinity>();
+  } else {
+	return abs(value);
+  }
+}
+
+/**
+ * @brief Apply the Gauss-Kronrod 10-21 rule on '[a, b]'.
+ *
+ * The Gauss nodes are the odd Kronrod nodes, so both estimates share the 21
+ * evaluations of the Kronrod rule.
+ *
+ * @param error Set to the difference between the Kronrod and Gauss estimates.
+ *
+ * @return Kronrod estimate of the integral.
+ */
+template<typename Scalar, typename Func>
+Scalar kronrod21(const Func& func, Scalar a, Scalar b, Scalar& error) {
+  using Consts = ConstsG10K21<Scalar>;
+
+  const Scalar mid = (b + a) / 2.0;
+  const Scalar half = (b - a) / 2.0;
+
+  Scalar integral_g = 0.0;
+  Scalar integral_k = 0.0;
+  for (Index i = 0; i < Consts::kNk; i++) {
+	Scalar value = func(mid + half * Consts::kXk[i]);
+	integral_k += Consts::kWk[i] * value;
+	if (i % 2 == 1) { integral_g += Consts::kWg[i / 2] * value; }
+  }
+
+  error = abs((integral_k - integral_g) * half);
+
+  return integral_k * half;
+}
+
+/**
+ * @brief Apply the Gauss-Kronrod 10-21 rule on a panel of a vector-valued
+ *  integrand.
+ *
+ * Sets the integral estimate of the panel from its bounds, and its error
+ * estimate to the maximum norm of the difference between the Kronrod and
+ * Gauss estimates.
+ */
+template<typename Scalar, typename Value, typename Func>
+void kronrod21(const Func& func, QuadratureInterval<Scalar, Value>& panel) {
+  using Consts = ConstsG10K21<Scalar>;
+
+  const Scalar mid = (panel.b + panel.a) / 2.0;
+  const Scalar half = (panel.b - panel.a) / 2.0;
+
+  // The first evaluation sets the number of components
+  Value value = func(mid + half * Consts::kXk[0]);
+  Value integral_k = Consts::kWk[0] * value;
+  Value integral_g = Value::Zero(value.size());
+  for (Index i = 1; i < Consts::kNk; i++) {
+	value = func(mid + half * Consts::kXk[i]);
+	integral_k += Consts::kWk[i] * value;
+	if (i % 2 == 1) { integral_g += Consts::kWg[i / 2] * value; }
+  }
+
+  panel.error = quadratureNorm(((integral_k - integral_g) * half).eval());
+  panel.integral = integral_k * half;
+}
+
+/**
+ * @brief Apply the Gauss-Kronrod 10-21 rule on each of 'num' panels.
+ *
+ * Sets the integral and error estimates of the panels from their bounds.
+ */
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+void kronrod21(const Func& func, QuadratureInterval<Scalar>* panels, Index num) {
+  for (Index j = 0; j < num; j++) {
+	panels[j].integral = kronrod21(func, panels[j].a, panels[j].b, panels[j].error);
+  }
+}
+
+/**
+ * @brief Apply the Gauss-Kronrod 10-21 rule on each of 'num' panels, with a
+ *  single evaluation of the integrand at the nodes of all of them.
+ *
+ * Sets the integral and error estimates of the panels from their bounds.
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+void kronrod21(const Func& func, QuadratureInterval<Scalar>* panels, Index num) {
+  using Consts = ConstsG10K21<Scalar>;
+
+  // Nodes of the panels one after the other
+  VectorX<Scalar> nodes(Consts::kNk * num);
+  for (Index j = 0; j < num; j++) {
+	const Scalar mid = (panels[j].b + panels[j].a) / 2.0;
+	const Scalar half = (panels[j].b - panels[j].a) / 2.0;
+	nodes.segment(j * Consts::kNk, Consts::kNk).array() = mid + half * Consts::kXk.array();
+  }
+
+  const VectorX<Scalar> values = func(nodes);
+  assert((values.size() == nodes.size()) && "Integrand must return one value per node");
+
+  // Gauss weights at the Kronrod nodes, the Gauss nodes being the odd ones
+  VectorX_s<Scalar, Consts::kNk> weights_g = VectorX_s<Scalar, Consts::kNk>::Zero();
+  weights_g(Eigen::seq(1, Consts::kNk - 2, 2)) = Consts::kWg;
+
+  // One column per panel
+  const Eigen::Map<const MatrixSQX<Scalar>> table(values.data(), Consts::kNk, num);
+  const VectorX<Scalar> integral_k = table.transpose() * Consts::kWk;
+  const VectorX<Scalar> integral_g = table.transpose() * weights_g;
+
+  for (Index j = 0; j < num; j++) {
+	const Scalar half = (panels[j].b - panels[j].a) / 2.0;
+	panels[j].integral = integral_k[j] * half;
+	panels[j].error = abs((integral_k[j] - integral_g[j]) * half);
+  }
+}
+
+/**
+ * @brief Integral of a panel refined until its error estimate meets 'tol'.
+ *
+ * The panel is split evenly in a number of subpanels growing with its error,
+ * all of which are evaluated in one call.
+ */
+template<typename Scalar, typename Func>
+Scalar quadratureA(const Func& func,
+				   const QuadratureInterval<Scalar>& panel,
+				   Scalar tol) {
+  if (panel.error < tol) { return panel.integral; }
+
+  Index n = ceil(1.0 + log2(panel.error / tol));
+  Scalar h = (panel.b - panel.a) / static_cast<Scalar>(n);
+
+  VectorT<QuadratureInterval<Scalar>> panels(n);
+  for (Index i = 0; i < n; i++) {
+	panels[i] = {panel.a + i * h, panel.a + (i + 1) * h, 0.0, 0.0};
+  }
+  kronrod21(func, panels.data(), n);
+
+  Scalar integral = 0.0;
+  for (const QuadratureInterval<Scalar>& subpanel : panels) {
+	integral += quadratureA(func, subpanel, tol);
+  }
+
+  return integral;
+}
+
+}
+
+/**
+ * @brief Result of an adaptive quadrature.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Value Type of the integral, a vector for vector-valued integrands.
+ */
+template<typename Scalar, typename Value = Scalar>
+struct QuadratureResult {
+  // Estimate of the integral
+  Value integral;
+  // Estimate of the absolute error of 'integral', in the maximum norm for
+  // vectors
+  Scalar error;
+  // Number of evaluations of the integrand
+  Index evaluations;
+  // Number of subintervals of the final partition
+  Index intervals;
+  // Whether the error estimate met the tolerance
+  bool converged;
+};
+
+namespace internal {
+
+/**
+ * @brief Adaptive quadrature driven by a heap of subintervals.
+ *
+ * @param rule Callable setting the estimates of a number of panels from their
+ *  bounds with the Gauss-Kronrod 10-21 rule, as in 'rule(panels, num)'.
+ *
+ * @see nuenv::quadratureAdaptive
+ */
+template<typename Scalar, typename Value = Scalar, typename Rule>
+QuadratureResult<Scalar, Value> quadratureAdaptive(const Rule& rule,
+												   Scalar a,
+												   Scalar b,
+												   Scalar abs_tol,
+												   Scalar rel_tol,
+												   Index max_evaluations) {
+  using Interval = QuadratureInterval<Scalar, Value>;
+
+  constexpr Index kCost = ConstsG10K21<Scalar>::kNk;
+
+  // The first interval costs one rule, and each bisection two more for one
+  // more interval
+  const Index capacity = 1 + max<Index>(max_evaluations - kCost, 0) / (2 * kCost);
+
+  VectorT<Interval> pool;
+  VectorT<Index> heap;
+  pool.reserve(capacity);
+  heap.reserve(capacity);
+
+  // Max-heap of the indexes of the intervals in the pool, by error
+  auto less = [&pool](Index i, Index j) { return pool[i].error < pool[j].error; };
+
+  Interval whole {a, b, {}, 0.0};
+  rule(&whole, 1);
+  pool.push_back(whole);
+  heap.push_back(0);
+
+  Index evaluations = kCost;
+  Value integral = whole.integral;
+  Scalar error = whole.error;
+
+  while (error > max(abs_tol, rel_tol * quadratureNorm(integral))
+	  && evaluations + 2 * kCost <= max_evaluations) {
+	const Interval worst = pool[heap.front()];
+	const Scalar mid = (worst.a + worst.b) / 2.0;
+
+	// Interval too narrow to be bisected in floating point, whatever the
+	// order of its bounds
+	if (mid == worst.a || mid == worst.b) { break; }
+
+	std::pop_heap(heap.begin(), heap.end(), less);
+	Index i = heap.back();
+	heap.pop_back();
+
+	Interval halves[2] = {{worst.a, mid, {}, 0.0}, {mid, worst.b, {}, 0.0}};
+	rule(halves, 2);
+	evaluations += 2 * kCost;
+
+	const Interval& left = halves[0];
+	const Interval& right = halves[1];
+
+	integral += left.integral + right.integral - worst.integral;
+	error += left.error + right.error - worst.error;
+
+	// The left half takes the slot of the bisected interval
+	pool[i] = left;
+	heap.push_back(i);
+	std::push_heap(heap.begin(), heap.end(), less);
+
+	pool.push_back(right);
+	heap.push_back(static_cast<Index>(pool.size()) - 1);
+	std::push_heap(heap.begin(), heap.end(), less);
+  }
+
+  // Sum afresh, discarding the rounding accumulated by the running sums
+  integral = pool.front().integral;
+  error = pool.front().error;
+  for (size_t i = 1; i < pool.size(); i++) {
+	integral += pool[i].integral;
+	error += pool[i].error;
+  }
+
+  return {integral,
+		  error,
+		  evaluations,
+		  static_cast<Index>(pool.size()),
+		  error <= max(abs_tol, rel_tol * quadratureNorm(integral))};
+}
+
 }
 
 /**
@@ -109,6 +474,8 @@ const VectorX_s<Scalar, ConstsG10K21<Scalar>::kNk> ConstsG10K21<Scalar>::kXk =
  * adaptive Gauss-Kronrod 10-21 technique.
  *
  * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda, a
+ *  'Lambda' or a 'FunctionRef'. It is called directly, without type erasure.
  *
  * @param func Function or method to integrate. It should take a single scalar
  *  argument and return a scalar value.
@@ -117,35 +484,83 @@ const VectorX_s<Scalar, ConstsG10K21<Scalar>::kNk> ConstsG10K21<Scalar>::kXk =
  * @param tol Absolute error tolerance. Default is 6e-6.
  *
  * @return Integral of 'func' from 'a' to 'b'.
+ *
+ * @see quadratureAdaptive for global error control and a bounded number of
+ *  evaluations, and the overload taking a 'ThreadPool' to integrate the
+ *  subintervals in parallel.
  */
-template<typename Scalar>
-Scalar quadratureA(Lambda<Scalar(Scalar)> func,
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+Scalar quadratureA(const Func& func,
 				   Scalar a,
 				   Scalar b,
 				   Scalar tol = 6e-6) {
-  using internal::ConstsG10K21;
+  Scalar error, integral = 0.0;
+  Scalar integral_k = internal::kronrod21(func, a, b, error);
 
-  Scalar aux, integral = 0.0;
+  if (error < tol) {
+	integral += integral_k;
+  } else {
+	Index n = ceil(1.0 + log2(error / tol));
+	Scalar h = (b - a) / static_cast<Scalar>(n);
 
-  Scalar integral_g = 0.0;
-  // TODO: Vectorize
-  for (Index i = 0; i < ConstsG10K21<Scalar>::kNg; i++) {
-	aux = ((b - a) * ConstsG10K21<Scalar>::kXg[i] + (b + a)) / 2.0;
-	integral_g += ConstsG10K21<Scalar>::kWg[i] * func(aux);
+	for (Index i = 0; i < n; i++) {
+	  integral += quadratureA(func, a + i * h, a + (i + 1) * h, tol);
+	}
   }
 
-  integral_g *= (b - a) / 2.0;
+  return integral;
+}
 
-  Scalar integral_k = 0.0;
-  // TODO: Vectorize
-  for (Index i = 0; i < ConstsG10K21<Scalar>::kNk; i++) {
-	aux = ((b - a) * ConstsG10K21<Scalar>::kXk[i] + (b + a)) / 2.0;
-	integral_k += ConstsG10K21<Scalar>::kWk[i] * func(aux);
-  }
+/**
+ * @brief Compute a definite integral, evaluating the integrand at many nodes
+ *  per call.
+ *
+ * Same as the scalar overload, but the nodes of all the subpanels a panel is
+ * split into are evaluated in a single call of 'func'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda or a
+ *  'BatchIntegrand'.
+ *
+ * @param func Function or method to integrate. It should take a vector of
+ *  nodes and return the vector of its values at them.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ * @param tol Absolute error tolerance. Default is 6e-6.
+ *
+ * @return Integral of 'func' from 'a' to 'b'.
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+Scalar quadratureA(const Func& func,
+				   Scalar a,
+				   Scalar b,
+				   Scalar tol = 6e-6) {
+  internal::QuadratureInterval<Scalar> whole {a, b, 0.0, 0.0};
+  internal::kronrod21(func, &whole, 1);
 
-  integral_k *= (b - a) / 2.0;
+  return internal::quadratureA(func, whole, tol);
+}
 
-  Scalar error = abs(integral_k - integral_g);
+namespace internal {
+
+/**
+ * @brief Integral of '[a, b]' with its subintervals integrated as tasks of
+ *  'pool', down to 'spawn_depth' levels of subdivision.
+ *
+ * The subintervals are split and summed in the same order as by the serial
+ * quadrature, so the result does not depend on the scheduling.
+ */
+template<typename Scalar, typename Func>
+Scalar quadratureAParallel(ThreadPool& pool,
+						   const Func& func,
+						   Scalar a,
+						   Scalar b,
+						   Scalar tol,
+						   Index spawn_depth) {
+  if (spawn_depth <= 0) { return nuenv::quadratureA(func, a, b, tol); }
+
+  Scalar error, integral = 0.0;
+  Scalar integral_k = kronrod21(func, a, b, error);
 
   if (error < tol) {
 	integral += integral_k;
@@ -153,15 +568,183 @@ Scalar quadratureA(Lambda<Scalar(Scalar)> func,
 	Index n = ceil(1.0 + log2(error / tol));
 	Scalar h = (b - a) / static_cast<Scalar>(n);
 
-	// TODO: Parallelize
-	for (Index i = 0; i < n; i++) {
-	  integral += quadratureA(func, a + i * h, a + (i + 1) * h, tol);
+	// The first subinterval is integrated by the calling thread
+	VectorT<Scalar> parts(n);
+	ThreadPool::Group group;
+	for (Index i = 1; i < n; i++) {
+	  pool.submit(group, [&, i]() {
+		parts[i] = quadratureAParallel(pool, func, a + i * h, a + (i + 1) * h, tol, spawn_depth - 1);
+	  });
 	}
+	parts[0] = quadratureAParallel(pool, func, a, a + h, tol, spawn_depth - 1);
+	pool.wait(group);
+
+	for (Index i = 0; i < n; i++) { integral += parts[i]; }
   }
 
   return integral;
 }
 
+}
+
+/**
+ * @brief Compute a definite integral in parallel.
+ *
+ * Same as the serial overload, but the subintervals are integrated as tasks
+ * of a work-stealing thread pool as they are subdivided. The subdivision and
+ * the order of the sums are those of the serial quadrature, so the result is
+ * the same bit for bit whatever the number of threads.
+ *
+ * Below 'spawn_depth' levels of subdivision, the subintervals are integrated
+ * serially within the task of their parent, bounding the number of tasks for
+ * cheap integrands.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
+ *
+ * @param pool Thread pool running the tasks, whose size sets the number of
+ *  threads.
+ * @param func Function or method to integrate. It should take a single scalar
+ *  argument and return a scalar value, and be safe to call concurrently.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ * @param tol Absolute error tolerance. Default is 6e-6.
+ * @param spawn_depth Levels of subdivision whose subintervals are integrated
+ *  as tasks. Default is 8.
+ *
+ * @return Integral of 'func' from 'a' to 'b'.
+ */
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+Scalar quadratureA(ThreadPool& pool,
+				   const Func& func,
+				   Scalar a,
+				   Scalar b,
+				   Scalar tol = 6e-6,
+				   Index spawn_depth = 8) {
+  return internal::quadratureAParallel(pool, func, a, b, tol, spawn_depth);
+}
+
+/**
+ * @brief Compute a definite integral with global error control.
+ *
+ * Integrate func from 'a' to 'b' with the Gauss-Kronrod 10-21 rule, refining
+ * the partition of the interval in the manner of QUADPACK's QAG: the
+ * subintervals are kept in a heap ordered by their error estimates, and the
+ * worst one is bisected until the total error estimate meets the tolerance or
+ * the evaluation budget is exhausted. Each subinterval costs 21 evaluations,
+ * and the subintervals are stored in a pool sized once from the budget.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
+ *
+ * @param func Function or method to integrate. It should take a single scalar
+ *  argument and return a scalar value.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ * @param abs_tol Absolute error tolerance. Default is 6e-6.
+ * @param rel_tol Error tolerance relative to the integral. The looser of both
+ *  tolerances applies. Default is 0.
+ * @param max_evaluations Largest number of evaluations of 'func'. Default is
+ *  21000, that is, up to 500 subintervals.
+ *
+ * @return Integral of 'func' from 'a' to 'b', with its error estimate.
+ */
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+QuadratureResult<Scalar> quadratureAdaptive(const Func& func,
+											Scalar a,
+											Scalar b,
+											Scalar abs_tol = 6e-6,
+											Scalar rel_tol = 0.0,
+											Index max_evaluations = 21000) {
+  auto rule = [&func](internal::QuadratureInterval<Scalar>* panels, Index num) {
+	internal::kronrod21(func, panels, num);
+  };
+
+  return internal::quadratureAdaptive(rule, a, b, abs_tol, rel_tol, max_evaluations);
+}
+
+/**
+ * @brief Compute a definite integral with global error control, evaluating
+ *  the integrand at many nodes per call.
+ *
+ * Same as the scalar overload, but both halves of a bisected subinterval are
+ * evaluated in a single call of 'func' at their 42 nodes.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda or a
+ *  'BatchIntegrand'.
+ *
+ * @param func Function or method to integrate. It should take a vector of
+ *  nodes and return the vector of its values at them.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ * @param abs_tol Absolute error tolerance. Default is 6e-6.
+ * @param rel_tol Error tolerance relative to the integral. The looser of both
+ *  tolerances applies. Default is 0.
+ * @param max_evaluations Largest number of evaluations of 'func' at a node.
+ *  Default is 21000, that is, up to 500 subintervals.
+ *
+ * @return Integral of 'func' from 'a' to 'b', with its error estimate.
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+QuadratureResult<Scalar> quadratureAdaptive(const Func& func,
+											Scalar a,
+											Scalar b,
+											Scalar abs_tol = 6e-6,
+											Scalar rel_tol = 0.0,
+											Index max_evaluations = 21000) {
+  auto rule = [&func](internal::QuadratureInterval<Scalar>* panels, Index num) {
+	internal::kronrod21(func, panels, num);
+  };
+
+  return internal::quadratureAdaptive(rule, a, b, abs_tol, rel_tol, max_evaluations);
+}
+
+/**
+ * @brief Compute the definite integrals of the components of a vector-valued
+ *  integrand with global error control.
+ *
+ * Same as the scalar overload, but a single partition of the interval serves
+ * all the components, sharing each evaluation of 'func' among them. The error
+ * estimate of a subinterval is the maximum norm of the error estimates of the
+ * components, so the tolerance bounds the error of every component, and the
+ * relative tolerance applies to the maximum norm of the integral.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
+ *
+ * @param func Function or method to integrate. It should take a single scalar
+ *  argument and return a vector, such as a 'VectorX' or any Eigen vector,
+ *  with the same number of components at every point.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ * @param abs_tol Absolute error tolerance. Default is 6e-6.
+ * @param rel_tol Error tolerance relative to the integral. The looser of both
+ *  tolerances applies. Default is 0.
+ * @param max_evaluations Largest number of evaluations of 'func'. Default is
+ *  21000, that is, up to 500 subintervals.
+ *
+ * @return Integrals of the components of 'func' from 'a' to 'b', with their
+ *  error estimate.
+ */
+template<typename Scalar, typename Func>
+requires VectorIntegrand<Func, Scalar>
+QuadratureResult<Scalar, internal::VectorIntegral<Func, Scalar>>
+quadratureAdaptive(const Func& func,
+				   Scalar a,
+				   Scalar b,
+				   Scalar abs_tol = 6e-6,
+				   Scalar rel_tol = 0.0,
+				   Index max_evaluations = 21000) {
+  using Value = internal::VectorIntegral<Func, Scalar>;
+
+  auto rule = [&func](internal::QuadratureInterval<Scalar, Value>* panels, Index num) {
+	for (Index j = 0; j < num; j++) { internal::kronrod21(func, panels[j]); }
+  };
+
+  return internal::quadratureAdaptive<Scalar, Value>(rule, a, b, abs_tol, rel_tol, max_evaluations);
+}
+
 /**
  * @brief Performs the Gauss-Legendre quadrature with 1 point for a given
  *  function.
@@ -170,6 +753,7 @@ Scalar quadratureA(Lambda<Scalar(Scalar)> func,
  * the Gauss-Legendre quadrature method with 1 point.
  *
  * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
  *
  * @param func Function or method to integrate. It should take a single
  *  scalar argument and return a scalar value.
@@ -178,8 +762,8 @@ Scalar quadratureA(Lambda<Scalar(Scalar)> func,
  *
  * @return Integral of 'func' over the interval [a, b].
  */
-template<typename Scalar>
-Scalar quadratureG1(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+Scalar quadratureG1(const Func& func, Scalar a, Scalar b) {
   Scalar h2 = b - a;
   Scalar integral = h2 * func(a + h2 / 2.0);
 
@@ -194,6 +778,7 @@ Scalar quadratureG1(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
  * the Gauss-Legendre quadrature method with 2 points.
  *
  * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
  *
  * @param func Function or method to integrate. It should take a single
  *  scalar argument and return a scalar value.
@@ -202,11 +787,11 @@ Scalar quadratureG1(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
  *
  * @return Integral of 'func' over the interval [a, b].
  */
-template<typename Scalar>
-Scalar quadratureG2(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+Scalar quadratureG2(const Func& func, Scalar a, Scalar b) {
   static constexpr Index n = 2;
-  static const VectorX_s<Scalar, n> w = {1.0, 1.0};
-  static const VectorX_s<Scalar, n> x = {-0.5773502692, 0.5773502692};
+  const VectorX_s<Scalar, n>& w = internal::ConstsGaussLegendre<Scalar, n>::kW;
+  const VectorX_s<Scalar, n>& x = internal::ConstsGaussLegendre<Scalar, n>::kX;
 
   Scalar aux, integral = 0.0;
   for (Index i = 0; i < n; i++) {
@@ -227,6 +812,7 @@ Scalar quadratureG2(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
  * the Gauss-Legendre quadrature method with 3 points.
  *
  * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand.
  *
  * @param func Function or method to integrate. It should take a single
  *  scalar argument and return a scalar value.
@@ -235,19 +821,11 @@ Scalar quadratureG2(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
  *
  * @return Integral of 'func' over the interval [a, b].
  */
-template<typename Scalar>
-Scalar quadratureG3(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
+template<typename Scalar, Callable<Scalar, Scalar> Func>
+Scalar quadratureG3(const Func& func, Scalar a, Scalar b) {
   static constexpr Index n = 3;
-  static const VectorX_s<Scalar, n> w = {
-	  0.5555555556,
-	  0.8888888889,
-	  0.5555555556
-  };
-  static const VectorX_s<Scalar, n> x = {
-	  -0.7745966692,
-	  0.0,
-	  0.7745966692
-  };
+  const VectorX_s<Scalar, n>& w = internal::ConstsGaussLegendre<Scalar, n>::kW;
+  const VectorX_s<Scalar, n>& x = internal::ConstsGaussLegendre<Scalar, n>::kX;
 
   Scalar aux, integral = 0.0;
   for (Index i = 0; i < n; i++) {
@@ -260,6 +838,73 @@ Scalar quadratureG3(Lambda<Scalar(Scalar)> func, Scalar a, Scalar b) {
   return integral;
 }
 
+/**
+ * @brief Performs the Gauss-Legendre quadrature with 1 point for a given
+ *  function evaluated at all the nodes in one call.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda or a
+ *  'BatchIntegrand'.
+ *
+ * @param func Function or method to integrate. It should take a vector of
+ *  nodes and return the vector of its values at them.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ *
+ * @return Integral of 'func' over the interval [a, b].
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+Scalar quadratureG1(const Func& func, Scalar a, Scalar b) {
+  const VectorX<Scalar> values = func(VectorX<Scalar>::Constant(1, (a + b) / 2.0));
+  assert((values.size() == 1) && "Integrand must return one value per node");
+
+  return (b - a) * values[0];
+}
+
+/**
+ * @brief Performs the Gauss-Legendre quadrature with 2 points for a given
+ *  function evaluated at all the nodes in one call.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda or a
+ *  'BatchIntegrand'.
+ *
+ * @param func Function or method to integrate. It should take a vector of
+ *  nodes and return the vector of its values at them.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ *
+ * @return Integral of 'func' over the interval [a, b].
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+Scalar quadratureG2(const Func& func, Scalar a, Scalar b) {
+  using Consts = internal::ConstsGaussLegendre<Scalar, 2>;
+
+  return internal::gaussLegendre(func, a, b, Consts::kX, Consts::kW);
+}
+
+/**
+ * @brief Performs the Gauss-Legendre quadrature with 3 points for a given
+ *  function evaluated at all the nodes in one call.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Func Type of the integrand, any callable such as a lambda or a
+ *  'BatchIntegrand'.
+ *
+ * @param func Function or method to integrate. It should take a vector of
+ *  nodes and return the vector of its values at them.
+ * @param a Lower limit of integration.
+ * @param b Upper limit of integration.
+ *
+ * @return Integral of 'func' over the interval [a, b].
+ */
+template<typename Scalar, Callable<VectorX<Scalar>, const VectorX<Scalar>&> Func>
+Scalar quadratureG3(const Func& func, Scalar a, Scalar b) {
+  using Consts = internal::ConstsGaussLegendre<Scalar, 3>;
+
+  return internal::gaussLegendre(func, a, b, Consts::kX, Consts::kW);
+}
+
 }
 
 #endif
@@ -26,12 +26,17 @@ class Rk4 final : public OdeSolver<Scalar, ScalarField> {
   ScalarField iter(Scalar t0, ScalarField x0, Scalar step);
 
   OdeSolution<Scalar, ScalarField> solve(
-	  const VectorX<Scalar>& t_eval,
+	  const VectorRef<Scalar>& t_eval,
 	  ScalarField x0,
 	  Lambda<bool(ScalarField)> stopEvent = [](ScalarField /*x*/) {
 		return false;
 	  });
 
+  template<Callable<bool, ScalarField> StopEvent>
+  OdeSolution<Scalar, ScalarField> solve(const VectorRef<Scalar>& t_eval,
+										 ScalarField x0,
+										 const StopEvent& stopEvent);
+
  private:
   static const Scalar
 	  c2, c3,
@@ -82,9 +87,24 @@ ScalarField RK4_EXTENSION::iter(Scalar t0,
 
 RK4_TEMPLATE
 OdeSolution<Scalar, ScalarField>
-RK4_EXTENSION::solve(const VectorX<Scalar>& t_eval,
+RK4_EXTENSION::solve(const VectorRef<Scalar>& t_eval,
 					 ScalarField x0,
 					 Lambda<bool(ScalarField)> stopEvent) {
+  return solve<Lambda<bool(ScalarField)>>(t_eval, x0, stopEvent);
+}
+
+/**
+ * @brief Solves the differential equation with a stop event of any callable
+ *  type, called directly after each step instead of through a 'Lambda'.
+ *
+ * @see OdeSolver::solve
+ */
+RK4_TEMPLATE
+template<Callable<bool, ScalarField> StopEvent>
+OdeSolution<Scalar, ScalarField>
+RK4_EXTENSION::solve(const VectorRef<Scalar>& t_eval,
+					 ScalarField x0,
+					 const StopEvent& stopEvent) {
   Scalar step;
   size_t size = t_eval.size();
   VectorX<ScalarField> x(size);
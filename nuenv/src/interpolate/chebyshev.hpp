@@ -0,0 +1,664 @@
+#ifndef NUENV_INTERPOLATE_CHEBYSHEV_H_
+#define NUENV_INTERPOLATE_CHEBYSHEV_H_
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/lambda.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <cassert>
+#include <ranges>
+
+namespace nuenv {
+
+template<typename Scalar>
+class PiecewiseChebyshev;
+
+/**
+ * @class Chebyshev
+ *
+ * @brief Approximate a smooth function on an interval by a Chebyshev series.
+ *
+ * The function is sampled at the Chebyshev points of the second kind, which
+ * are nested, so doubling the degree reuses every sample taken so far. The
+ * degree doubles until the tail of the series falls below the tolerance, and
+ * the series is then truncated to the last significant coefficient. Once
+ * built, the approximant replaces the function at the cost of a Clenshaw
+ * recurrence, and its derivative and integrals are computed exactly from the
+ * coefficients.
+ *
+ * Points out of the interval are extrapolated, which quickly loses accuracy.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class Chebyshev {
+ public:
+  Chebyshev(const Lambda<Scalar(Scalar)>& func,
+			Scalar a,
+			Scalar b,
+			Scalar tol = 1e-13,
+			Index max_degree = 1024);
+
+  Chebyshev(const VectorRef<Scalar>& coeffs, Scalar a, Scalar b);
+
+  Scalar evaluate(Scalar x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  VectorX<Scalar> evaluate(const Points& x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void evaluate(const Points& x, VectorX<Scalar>& out) const;
+
+  Chebyshev derivative() const;
+
+  Chebyshev antiderivative() const;
+
+  Scalar integral() const;
+
+  Scalar integral(Scalar lower, Scalar upper) const;
+
+  const VectorX<Scalar>& coefficients() const { return coeffs_; }
+
+  Index degree() const { return coeffs_.size() - 1; }
+
+  Scalar lower() const { return a_; }
+
+  Scalar upper() const { return b_; }
+
+  bool converged() const { return converged_; }
+
+ private:
+  friend class PiecewiseChebyshev<Scalar>;
+
+  using Block = Eigen::Array<Scalar, 256, 1>;
+
+  using Array = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+
+  static constexpr Index kMinDegree = 16;
+
+  template<typename Points>
+  void clenshaw(const Points& x, Index offset, Scalar* out, Index num) const;
+
+  VectorX<Scalar> coeffs_;
+  Scalar a_;
+  Scalar b_;
+  bool converged_;
+};
+
+/**
+ * Constructs the approximant by sampling a function.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param func Function to approximate. It should take a single scalar argument
+ *  and return a scalar value, and is only called during construction.
+ * @param a Lower bound of the interval.
+ * @param b Upper bound of the interval, must be greater than 'a'.
+ * @param tol Tolerance on the coefficients, relative to the largest of them.
+ * @param max_degree Maximum degree. The degree doubles from 16, so it is
+ *  effectively rounded down to a power of 2 times 16.
+ */
+template<typename Scalar>
+Chebyshev<Scalar>::Chebyshev(const Lambda<Scalar(Scalar)>& func,
+							 const Scalar a,
+							 const Scalar b,
+							 const Scalar tol,
+							 const Index max_degree)
+	: a_(a), b_(b), converged_(false) {
+  assert((a < b) && "Interval must not be empty");
+  assert((max_degree >= kMinDegree) && "Maximum degree must be at least 16");
+
+  const Scalar mid = (a + b) / 2.0;
+  const Scalar half = (b - a) / 2.0;
+
+  Index n = kMinDegree;
+  VectorX<Scalar> values(n + 1);
+  for (Index k = 0; k <= n; k++) { values[k] = func(mid + half * cos(pi * k / n)); }
+
+  VectorX<Scalar> table, coeffs;
+  Index size;
+  while (true) {
+	// Discrete cosine transform of the samples, with cos(pi * m / n) tabulated
+	table.resize(2 * n);
+	for (Index m = 0; m < 2 * n; m++) { table[m] = cos(pi * m / n); }
+
+	coeffs.resize(n + 1);
+	for (Index j = 0; j <= n; j++) {
+	  Scalar sum = (values[0] + values[n] * table[(j * n) % (2 * n)]) / 2.0;
+	  for (Index k = 1; k < n; k++) { sum += values[k] * table[(j * k) % (2 * n)]; }
+	  coeffs[j] = 2.0 * sum / n;
+	}
+	coeffs[0] /= 2.0;
+	coeffs[n] /= 2.0;
+
+	Scalar cutoff = tol * coeffs.cwiseAbs().maxCoeff();
+	Index tail = max<Index>(2, n / 8);
+	converged_ = coeffs.tail(tail).cwiseAbs().maxCoeff() <= cutoff;
+
+	if (converged_ || 2 * n > max_degree) {
+	  // Truncate after the last significant coefficient
+	  size = n + 1;
+	  while (size > 1 && abs(coeffs[size - 1]) <= cutoff) { size--; }
+	  break;
+	}
+
+	// The points of degree n are the even points of degree 2n
+	VectorX<Scalar> refined(2 * n + 1);
+	for (Index k = 0; k <= n; k++) { refined[2 * k] = values[k]; }
+	for (Index k = 1; k < 2 * n; k += 2) {
+	  refined[k] = func(mid + half * cos(pi * k / (2 * n)));
+	}
+
+	values.swap(refined);
+	n *= 2;
+  }
+
+  coeffs_ = coeffs.head(size);
+}
+
+/**
+ * Constructs the approximant from its coefficients.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param coeffs Coefficients of the Chebyshev polynomials, from degree 0.
+ *  Must not be empty.
+ * @param a Lower bound of the interval.
+ * @param b Upper bound of the interval, must be greater than 'a'.
+ */
+template<typename Scalar>
+Chebyshev<Scalar>::Chebyshev(const VectorRef<Scalar>& coeffs, const Scalar a, const Scalar b)
+	: coeffs_(coeffs), a_(a), b_(b), converged_(true) {
+  assert((coeffs.size() > 0) && "Coefficients must not be empty");
+  assert((a < b) && "Interval must not be empty");
+}
+
+/**
+ * @brief Evaluate the approximant.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be evaluated.
+ *
+ * @return Value of the approximant at 'x'.
+ */
+template<typename Scalar>
+Scalar Chebyshev<Scalar>::evaluate(Scalar x) const {
+  const Scalar t = (2.0 * x - a_ - b_) / (b_ - a_);
+
+  Scalar b1 = 0.0, b2 = 0.0;
+  for (Index j = degree(); j > 0; j--) {
+	Scalar tmp = 2.0 * t * b1 - b2 + coeffs_[j];
+	b2 = b1;
+	b1 = tmp;
+  }
+
+  return t * b1 - b2 + coeffs_[0];
+}
+
+/**
+ * @brief Evaluate the approximant at many points.
+ *
+ * The recurrence runs over blocks of points at once, with vectorized
+ * arithmetic.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a view.
+ *
+ * @param x Points to be evaluated.
+ *
+ * @return Values of the approximant at 'x'.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+VectorX<Scalar> Chebyshev<Scalar>::evaluate(const Points& x) const {
+  VectorX<Scalar> out;
+  evaluate(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Evaluate the approximant at many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a view.
+ *
+ * @param x Points to be evaluated.
+ * @param out Values of the approximant at 'x'. Resized to the number of points.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void Chebyshev<Scalar>::evaluate(const Points& x, VectorX<Scalar>& out) const {
+  Index num = std::ranges::ssize(x);
+  out.resize(num);
+  clenshaw(x, 0, out.data(), num);
+}
+
+/**
+ * @brief Derivative of the approximant.
+ *
+ * @return Approximant of one degree less, exactly the derivative of this one.
+ */
+template<typename Scalar>
+Chebyshev<Scalar> Chebyshev<Scalar>::derivative() const {
+  const Index n = degree();
+
+  if (n == 0) { return Chebyshev(VectorX<Scalar>::Zero(1), a_, b_); }
+
+  // Backward recurrence d_(k-1) = d_(k+1) + 2 k c_k
+  VectorX<Scalar> d = VectorX<Scalar>::Zero(n + 1);
+  for (Index k = n; k > 0; k--) {
+	d[k - 1] = (k + 1 <= n ? d[k + 1] : 0.0) + 2.0 * k * coeffs_[k];
+  }
+  d[0] /= 2.0;
+
+  return Chebyshev(VectorX<Scalar>(d.head(n) * (2.0 / (b_ - a_))), a_, b_);
+}
+
+/**
+ * @brief Antiderivative of the approximant.
+ *
+ * @return Approximant of one degree more, exactly the antiderivative of this
+ *  one that vanishes at the lower bound of the interval.
+ */
+template<typename Scalar>
+Chebyshev<Scalar> Chebyshev<Scalar>::antiderivative() const {
+  const Index n = degree();
+  const Scalar half = (b_ - a_) / 2.0;
+
+  auto c = [this, n](Index j) { return j <= n ? coeffs_[j] : Scalar(0.0); };
+
+  VectorX<Scalar> d(n + 2);
+  d[1] = half * (c(0) - c(2) / 2.0);
+  for (Index k = 2; k <= n + 1; k++) { d[k] = half * (c(k - 1) - c(k + 1)) / (2.0 * k); }
+
+  // T_k(-1) = (-1)^k
+  d[0] = 0.0;
+  for (Index k = 1; k <= n + 1; k++) { d[0] += (k % 2 == 0) ? -d[k] : d[k]; }
+
+  return Chebyshev(d, a_, b_);
+}
+
+/**
+ * @brief Integral of the approximant over its interval.
+ */
+template<typename Scalar>
+Scalar Chebyshev<Scalar>::integral() const {
+  // The integral of T_j over [-1, 1] is 2 / (1 - j^2) for even j, zero otherwise
+  Scalar sum = 0.0;
+  for (Index j = 0; j <= degree(); j += 2) {
+	sum += 2.0 * coeffs_[j] / (1.0 - static_cast<Scalar>(j * j));
+  }
+
+  return sum * (b_ - a_) / 2.0;
+}
+
+/**
+ * @brief Integral of the approximant from 'lower' to 'upper'.
+ */
+template<typename Scalar>
+Scalar Chebyshev<Scalar>::integral(Scalar lower, Scalar upper) const {
+  Chebyshev primitive = antiderivative();
+
+  return primitive.evaluate(upper) - primitive.evaluate(lower);
+}
+
+/**
+ * @brief Clenshaw recurrence over the 'num' points of 'x' from 'offset',
+ *  block by block.
+ */
+template<typename Scalar>
+template<typename Points>
+void Chebyshev<Scalar>::clenshaw(const Points& x, Index offset, Scalar* out, Index num) const {
+  const Scalar scale = 2.0 / (b_ - a_);
+  const Scalar shift = (a_ + b_) / (b_ - a_);
+
+  Block t, b1, b2, tmp;
+  for (Index begin = 0; begin < num; begin += Block::SizeAtCompileTime) {
+	Index n = min<Index>(Block::SizeAtCompileTime, num - begin);
+
+	for (Index k = 0; k < n; k++) { t[k] = x[offset + begin + k]; }
+	t.head(n) = t.head(n) * scale - shift;
+	b1.head(n).setZero();
+	b2.head(n).setZero();
+
+	for (Index j = degree(); j > 0; j--) {
+	  tmp.head(n) = 2.0 * t.head(n) * b1.head(n) - b2.head(n) + coeffs_[j];
+	  b2.head(n) = b1.head(n);
+	  b1.head(n) = tmp.head(n);
+	}
+
+	Eigen::Map<Array>(out + begin, n) = t.head(n) * b1.head(n) - b2.head(n) + coeffs_[0];
+  }
+}
+
+/**
+ * @class PiecewiseChebyshev
+ *
+ * @brief Approximate a function on an interval by Chebyshev series on
+ *  subintervals.
+ *
+ * An interval on which the series does not converge within the maximum
+ * degree is bisected, recursively, so that functions with kinks or steep
+ * fronts are resolved by short pieces of low degree where needed and long
+ * pieces elsewhere. The pieces are located with a search index over their
+ * breakpoints.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class PiecewiseChebyshev {
+ public:
+  PiecewiseChebyshev(const Lambda<Scalar(Scalar)>& func,
+					 Scalar a,
+					 Scalar b,
+					 Scalar tol = 1e-13,
+					 Index max_degree = 128,
+					 Index max_depth = 32);
+
+  PiecewiseChebyshev(const PiecewiseChebyshev& other);
+
+  PiecewiseChebyshev& operator=(const PiecewiseChebyshev& other);
+
+  Scalar evaluate(Scalar x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  VectorX<Scalar> evaluate(const Points& x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void evaluate(const Points& x, VectorX<Scalar>& out) const;
+
+  PiecewiseChebyshev derivative() const;
+
+  PiecewiseChebyshev antiderivative() const;
+
+  Scalar integral() const;
+
+  const VectorX<Scalar>& breakpoints() const { return breaks_; }
+
+  const VectorT<Chebyshev<Scalar>>& pieces() const { return pieces_; }
+
+  bool converged() const;
+
+ private:
+  PiecewiseChebyshev(const VectorX<Scalar>& breaks, VectorT<Chebyshev<Scalar>> pieces);
+
+  static VectorX<Scalar> approximate(const Lambda<Scalar(Scalar)>& func,
+									 Scalar a,
+									 Scalar b,
+									 Scalar tol,
+									 Index max_degree,
+									 Index max_depth,
+									 VectorT<Chebyshev<Scalar>>& pieces);
+
+  static void split(const Lambda<Scalar(Scalar)>& func,
+					Scalar a,
+					Scalar b,
+					Scalar tol,
+					Index max_degree,
+					Index depth,
+					VectorT<Chebyshev<Scalar>>& pieces,
+					VectorT<Scalar>& breaks);
+
+  Index piece(Index index) const;
+
+  VectorT<Chebyshev<Scalar>> pieces_;
+  VectorX<Scalar> breaks_;
+  SortedIndex<Scalar> index_;
+};
+
+/**
+ * Constructs the approximant by sampling a function.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param func Function to approximate. It should take a single scalar argument
+ *  and return a scalar value, and is only called during construction.
+ * @param a Lower bound of the interval.
+ * @param b Upper bound of the interval, must be greater than 'a'.
+ * @param tol Tolerance on the coefficients of each piece, relative to the
+ *  largest of them.
+ * @param max_degree Maximum degree of each piece.
+ * @param max_depth Maximum number of bisections of the interval. Pieces at
+ *  this depth are kept even if they have not converged.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar>::PiecewiseChebyshev(const Lambda<Scalar(Scalar)>& func,
+											   const Scalar a,
+											   const Scalar b,
+											   const Scalar tol,
+											   const Index max_degree,
+											   const Index max_depth)
+	: pieces_(),
+	  breaks_(approximate(func, a, b, tol, max_degree, max_depth, pieces_)),
+	  index_(breaks_) {}
+
+/**
+ * @brief Copy constructor.
+ *
+ * The search index is rebuilt over the copied breakpoints.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar>::PiecewiseChebyshev(const PiecewiseChebyshev& other)
+	: pieces_(other.pieces_), breaks_(other.breaks_), index_(breaks_) {}
+
+/**
+ * @brief Assignment operator.
+ *
+ * The search index is rebuilt over the copied breakpoints.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar>& PiecewiseChebyshev<Scalar>::operator=(const PiecewiseChebyshev& other) {
+  pieces_ = other.pieces_;
+  breaks_ = other.breaks_;
+  index_ = SortedIndex<Scalar>(breaks_);
+
+  return *this;
+}
+
+/**
+ * Constructs the approximant from its breakpoints and pieces.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar>::PiecewiseChebyshev(const VectorX<Scalar>& breaks,
+											   VectorT<Chebyshev<Scalar>> pieces)
+	: pieces_(std::move(pieces)), breaks_(breaks), index_(breaks_) {}
+
+/**
+ * @brief Evaluate the approximant.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be evaluated.
+ *
+ * @return Value of the approximant at 'x'.
+ */
+template<typename Scalar>
+Scalar PiecewiseChebyshev<Scalar>::evaluate(Scalar x) const {
+  return pieces_[piece(SearchSorted(index_, x))].evaluate(x);
+}
+
+/**
+ * @brief Evaluate the approximant at many points.
+ *
+ * The pieces of all points are found with a single batched search, and each
+ * run of consecutive points on the same piece is evaluated at once, so sorted
+ * points are evaluated with as few recurrences as there are pieces.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a view.
+ *
+ * @param x Points to be evaluated.
+ *
+ * @return Values of the approximant at 'x'.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+VectorX<Scalar> PiecewiseChebyshev<Scalar>::evaluate(const Points& x) const {
+  VectorX<Scalar> out;
+  evaluate(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Evaluate the approximant at many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a view.
+ *
+ * @param x Points to be evaluated.
+ * @param out Values of the approximant at 'x'. Resized to the number of points.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void PiecewiseChebyshev<Scalar>::evaluate(const Points& x, VectorX<Scalar>& out) const {
+  Index num = std::ranges::ssize(x);
+  out.resize(num);
+
+  VectorX<Index> index;
+  SearchSorted(index_, x, index);
+
+  Index begin = 0;
+  while (begin < num) {
+	Index p = piece(index[begin]);
+	Index end = begin + 1;
+	while (end < num && piece(index[end]) == p) { end++; }
+
+	pieces_[p].clenshaw(x, begin, out.data() + begin, end - begin);
+	begin = end;
+  }
+}
+
+/**
+ * @brief Derivative of the approximant, piece by piece.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar> PiecewiseChebyshev<Scalar>::derivative() const {
+  VectorT<Chebyshev<Scalar>> pieces;
+  pieces.reserve(pieces_.size());
+  for (const Chebyshev<Scalar>& p : pieces_) { pieces.push_back(p.derivative()); }
+
+  return PiecewiseChebyshev(breaks_, std::move(pieces));
+}
+
+/**
+ * @brief Antiderivative of the approximant.
+ *
+ * @return Approximant whose pieces are the antiderivatives of these, shifted
+ *  to be continuous and to vanish at the lower bound of the interval.
+ */
+template<typename Scalar>
+PiecewiseChebyshev<Scalar> PiecewiseChebyshev<Scalar>::antiderivative() const {
+  VectorT<Chebyshev<Scalar>> pieces;
+  pieces.reserve(pieces_.size());
+
+  Scalar offset = 0.0;
+  for (const Chebyshev<Scalar>& p : pieces_) {
+	pieces.push_back(p.antiderivative());
+	pieces.back().coeffs_[0] += offset;
+	offset += p.integral();
+  }
+
+  return PiecewiseChebyshev(breaks_, std::move(pieces));
+}
+
+/**
+ * @brief Integral of the approximant over its interval.
+ */
+template<typename Scalar>
+Scalar PiecewiseChebyshev<Scalar>::integral() const {
+  Scalar sum = 0.0;
+  for (const Chebyshev<Scalar>& p : pieces_) { sum += p.integral(); }
+
+  return sum;
+}
+
+/**
+ * @brief Whether every piece has converged to the tolerance.
+ */
+template<typename Scalar>
+bool PiecewiseChebyshev<Scalar>::converged() const {
+  for (const Chebyshev<Scalar>& p : pieces_) {
+	if (!p.converged()) { return false; }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Approximate the function on '[a, b]' by pieces.
+ *
+ * @return Breakpoints of the pieces, which are appended to 'pieces'.
+ */
+template<typename Scalar>
+VectorX<Scalar> PiecewiseChebyshev<Scalar>::approximate(const Lambda<Scalar(Scalar)>& func,
+														Scalar a,
+														Scalar b,
+														Scalar tol,
+														Index max_degree,
+														Index max_depth,
+														VectorT<Chebyshev<Scalar>>& pieces) {
+  assert((a < b) && "Interval must not be empty");
+
+  VectorT<Scalar> breaks {a};
+  split(func, a, b, tol, max_degree, max_depth, pieces, breaks);
+
+  VectorX<Scalar> out = Eigen::Map<const VectorX<Scalar>>(breaks.data(),
+														  static_cast<Index>(breaks.size()));
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Approximate the function on '[a, b]', bisecting it until the pieces
+ *  converge, and append the pieces and their upper breakpoints in order.
+ */
+template<typename Scalar>
+void PiecewiseChebyshev<Scalar>::split(const Lambda<Scalar(Scalar)>& func,
+									   Scalar a,
+									   Scalar b,
+									   Scalar tol,
+									   Index max_degree,
+									   Index depth,
+									   VectorT<Chebyshev<Scalar>>& pieces,
+									   VectorT<Scalar>& breaks) {
+  Chebyshev<Scalar> approx(func, a, b, tol, max_degree);
+
+  if (approx.converged() || depth == 0) {
+	pieces.push_back(std::move(approx));
+	breaks.push_back(b);
+	return;
+  }
+
+  Scalar mid = (a + b) / 2.0;
+  split(func, a, mid, tol, max_degree, depth - 1, pieces, breaks);
+  split(func, mid, b, tol, max_degree, depth - 1, pieces, breaks);
+}
+
+/**
+ * @brief Piece starting at the breakpoint 'index', clamped to the pieces.
+ */
+template<typename Scalar>
+Index PiecewiseChebyshev<Scalar>::piece(Index index) const {
+  return min<Index>(index, static_cast<Index>(pieces_.size()) - 1);
+}
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,603 @@
+#ifndef NUENV_INTERPOLATE_CUBIC_H_
+#define NUENV_INTERPOLATE_CUBIC_H_
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace nuenv {
+
+namespace internal {
+
+/**
+ * @brief Solve a tridiagonal system of equations in place with the Thomas
+ *  algorithm.
+ *
+ * @param sub Subdiagonal, 'sub[i]' multiplies the unknown 'i - 1' of row 'i'.
+ *  'sub[0]' is ignored. Overwritten.
+ * @param diag Diagonal. Overwritten.
+ * @param sup Superdiagonal, 'sup[i]' multiplies the unknown 'i + 1' of row
+ *  'i'. The last element is ignored.
+ * @param rhs Right-hand side, overwritten with the solution.
+ */
+template<typename Scalar>
+void solveTridiagonal(VectorX<Scalar>& sub,
+					  VectorX<Scalar>& diag,
+					  const VectorX<Scalar>& sup,
+					  VectorX<Scalar>& rhs) {
+  Index size = diag.size();
+
+  for (Index i = 1; i < size; i++) {
+	Scalar w = sub[i] / diag[i - 1];
+	diag[i] -= w * sup[i - 1];
+	rhs[i] -= w * rhs[i - 1];
+  }
+
+  rhs[size - 1] /= diag[size - 1];
+  for (Index i = size - 1; i > 0; i--) {
+	rhs[i - 1] = (rhs[i - 1] - sup[i - 1] * rhs[i]) / diag[i - 1];
+  }
+}
+
+/**
+ * @brief Slopes of the segments between consecutive points.
+ */
+template<typename Scalar>
+VectorX<Scalar> secantSlopes(const VectorRef<Scalar>& x, const VectorRef<Scalar>& y) {
+  Index size = x.size();
+
+  return (y.tail(size - 1) - y.head(size - 1)).cwiseQuotient(x.tail(size - 1) - x.head(size - 1));
+}
+
+} // namespace internal
+
+/**
+ * @class HermiteInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function with piecewise cubic Hermite
+ *  polynomials.
+ *
+ * Each segment is the cubic matching the values and the derivatives of the
+ * function at its ends. Its coefficients are solved for on construction and
+ * stored together with the start of the segment, aligned so that every
+ * evaluation touches a single cache line after the search. The table is read
+ * from any vector with contiguous storage without an intermediate copy.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class HermiteInterp1d {
+ public:
+  HermiteInterp1d(const VectorRef<Scalar>& x,
+				  const VectorRef<Scalar>& y,
+				  const VectorRef<Scalar>& dydx,
+				  bool check_bounds = true);
+
+  HermiteInterp1d(const HermiteInterp1d& other);
+
+  HermiteInterp1d& operator=(const HermiteInterp1d& other);
+
+  Scalar evaluate(Scalar x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  VectorX<Scalar> evaluate(const Points& x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void evaluate(const Points& x, VectorX<Scalar>& out) const;
+
+ private:
+  using Block = Eigen::Array<Scalar, 256, 1>;
+
+  // Polynomial 'a + b t + c t^2 + d t^3' with 't = x - x0'
+  struct alignas(8 * sizeof(Scalar)) Segment {
+	Scalar x0;
+	Scalar a;
+	Scalar b;
+	Scalar c;
+	Scalar d;
+  };
+
+  VectorX<Scalar> x_;
+  Scalar y_first_;
+  Scalar y_last_;
+  size_t size_;
+  bool check_bounds_;
+  SortedIndex<Scalar> index_;
+  VectorT<Segment> segments_;
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing.
+ * @param y Array of y-values representing the dependent variable.
+ * @param dydx Array of derivatives of 'y' with respect to 'x'.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+HermiteInterp1d<Scalar>::HermiteInterp1d(const VectorRef<Scalar>& x,
+										 const VectorRef<Scalar>& y,
+										 const VectorRef<Scalar>& dydx,
+										 const bool check_bounds)
+	: x_(x),
+	  y_first_(y[0]),
+	  y_last_(y[y.size() - 1]),
+	  size_(x.size()),
+	  check_bounds_(check_bounds),
+	  index_(x_),
+	  segments_(x.size() - 1) {
+  assert((x.size() > 1) && "Arrays must have at least 2 elements");
+  assert((x.size() == y.size() && x.size() == dydx.size())
+			 && "Arrays 'x', 'y' and 'dydx' must have same size");
+
+  for (size_t i = 0; i + 1 < size_; i++) {
+	Scalar h = x[i + 1] - x[i];
+	Scalar slope = (y[i + 1] - y[i]) / h;
+
+	segments_[i] = {x[i],
+					y[i],
+					dydx[i],
+					(3.0 * slope - 2.0 * dydx[i] - dydx[i + 1]) / h,
+					(dydx[i] + dydx[i + 1] - 2.0 * slope) / (h * h)};
+  }
+}
+
+/**
+ * @brief Copy constructor.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar>
+HermiteInterp1d<Scalar>::HermiteInterp1d(const HermiteInterp1d& other)
+	: x_(other.x_),
+	  y_first_(other.y_first_),
+	  y_last_(other.y_last_),
+	  size_(other.size_),
+	  check_bounds_(other.check_bounds_),
+	  index_(x_),
+	  segments_(other.segments_) {}
+
+/**
+ * @brief Assignment operator.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar>
+HermiteInterp1d<Scalar>& HermiteInterp1d<Scalar>::operator=(const HermiteInterp1d& other) {
+  x_ = other.x_;
+  y_first_ = other.y_first_;
+  y_last_ = other.y_last_;
+  size_ = other.size_;
+  check_bounds_ = other.check_bounds_;
+  index_ = SortedIndex<Scalar>(x_);
+  segments_ = other.segments_;
+
+  return *this;
+}
+
+/**
+ * @brief Cubic interpolation.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar>
+Scalar HermiteInterp1d<Scalar>::evaluate(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_first_; }
+  else if (x >= x_[size_ - 1]) { return y_last_; }
+
+  const Segment& s = segments_[SearchSorted(index_, x)];
+  Scalar t = x - s.x0;
+
+  return s.a + t * (s.b + t * (s.c + t * s.d));
+}
+
+/**
+ * @brief Cubic interpolation of many points.
+ *
+ * The segments of all points are found at once, in a single merge pass over
+ * 'x' when the points are sorted, and the polynomials are evaluated with
+ * vectorized arithmetic.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView', which is read without a copy.
+ *
+ * @param x Points to be interpolated.
+ *
+ * @return Interpolated values at 'x'.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+VectorX<Scalar> HermiteInterp1d<Scalar>::evaluate(const Points& x) const {
+  VectorX<Scalar> out;
+  evaluate(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Cubic interpolation of many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void HermiteInterp1d<Scalar>::evaluate(const Points& x, VectorX<Scalar>& out) const {
+  assert(!(check_bounds_ && std::ranges::any_of(x, [this](Scalar p) {
+	return p < x_[0] && p > x_[size_ - 1];
+  })) && "'x' is out of bounds");
+
+  Index num = std::ranges::ssize(x);
+  out.resize(num);
+
+  VectorX<Index> index;
+  SearchSorted(index_, x, index);
+
+  const Index last = static_cast<Index>(size_) - 1;
+
+  Block xs, t, a, b, c, d;
+  for (Index begin = 0; begin < num; begin += Block::SizeAtCompileTime) {
+	Index n = min<Index>(Block::SizeAtCompileTime, num - begin);
+
+	for (Index k = 0; k < n; ++k) {
+	  const Segment& s = segments_[min(index[begin + k], last - 1)];
+	  xs[k] = x[begin + k];
+	  t[k] = xs[k] - s.x0;
+	  a[k] = s.a;
+	  b[k] = s.b;
+	  c[k] = s.c;
+	  d[k] = s.d;
+	}
+
+	auto seg = out.segment(begin, n).array();
+	seg = a.head(n) + t.head(n) * (b.head(n) + t.head(n) * (c.head(n) + t.head(n) * d.head(n)));
+
+	seg = (xs.head(n) < x_[0]).select(y_first_, (xs.head(n) >= x_[last]).select(y_last_, seg));
+  }
+}
+
+/**
+ * @brief Boundary condition of a cubic spline.
+ */
+enum class SplineBoundary {
+  Natural,   ///< Zero second derivative at both ends.
+  NotAKnot,  ///< Continuous third derivative at the second and second to last points.
+  Clamped,   ///< Given first derivative at both ends.
+};
+
+namespace internal {
+
+/**
+ * @brief First derivatives of a cubic spline at its points.
+ *
+ * Solves the O(n) tridiagonal system for the derivatives that make the
+ * second derivative continuous.
+ */
+template<typename Scalar>
+VectorX<Scalar> splineSlopes(const VectorRef<Scalar>& x,
+							 const VectorRef<Scalar>& y,
+							 SplineBoundary boundary,
+							 Scalar dydx_first,
+							 Scalar dydx_last) {
+  assert((x.size() > 1) && "Arrays must have at least 2 elements");
+
+  Index size = x.size();
+  const VectorX<Scalar> h = x.tail(size - 1) - x.head(size - 1);
+  const VectorX<Scalar> slope = secantSlopes(x, y);
+
+  VectorX<Scalar> m(size);
+
+  if (boundary == SplineBoundary::Clamped) {
+	if (size == 2) { return Vector2X<Scalar>(dydx_first, dydx_last); }
+  } else if (size == 2) {
+	// A line is the only spline through 2 points
+	return VectorX<Scalar>::Constant(2, slope[0]);
+  } else if (size == 3 && boundary == SplineBoundary::NotAKnot) {
+	// Not-a-knot through 3 points is the parabola through them
+	Scalar curvature = (slope[1] - slope[0]) / (x[2] - x[0]);
+	for (Index i = 0; i < 3; i++) {
+	  m[i] = slope[0] + curvature * (2.0 * x[i] - x[0] - x[1]);
+	}
+	return m;
+  }
+
+  VectorX<Scalar> sub(size), diag(size), sup(size);
+
+  for (Index i = 1; i < size - 1; i++) {
+	sub[i] = h[i];
+	diag[i] = 2.0 * (h[i - 1] + h[i]);
+	sup[i] = h[i - 1];
+	m[i] = 3.0 * (h[i] * slope[i - 1] + h[i - 1] * slope[i]);
+  }
+
+  const Index n = size - 1;
+
+  switch (boundary) {
+	case SplineBoundary::Natural:
+	  diag[0] = 2.0;
+	  sup[0] = 1.0;
+	  m[0] = 3.0 * slope[0];
+	  sub[n] = 1.0;
+	  diag[n] = 2.0;
+	  m[n] = 3.0 * slope[n - 1];
+	  break;
+	case SplineBoundary::NotAKnot: {
+	  Scalar d0 = h[0] + h[1];
+	  diag[0] = h[1];
+	  sup[0] = d0;
+	  m[0] = ((h[0] + 2.0 * d0) * h[1] * slope[0] + h[0] * h[0] * slope[1]) / d0;
+
+	  Scalar dn = h[n - 1] + h[n - 2];
+	  sub[n] = dn;
+	  diag[n] = h[n - 2];
+	  m[n] = (h[n - 1] * h[n - 1] * slope[n - 2] + (2.0 * dn + h[n - 1]) * h[n - 2] * slope[n - 1]) / dn;
+	  break;
+	}
+	default:
+	  diag[0] = 1.0;
+	  sup[0] = 0.0;
+	  m[0] = dydx_first;
+	  sub[n] = 0.0;
+	  diag[n] = 1.0;
+	  m[n] = dydx_last;
+  }
+
+  solveTridiagonal(sub, diag, sup, m);
+
+  // Returns with copy elision
+  return m;
+}
+
+/**
+ * @brief Derivatives of the monotone piecewise cubic Hermite interpolant.
+ *
+ * @see Fritsch, F. N., Butland, J., A method for constructing local monotone
+ *  piecewise cubic interpolants. SIAM Journal on Scientific and Statistical
+ *  Computing, 5(2), 1984.
+ */
+template<typename Scalar>
+VectorX<Scalar> pchipSlopes(const VectorRef<Scalar>& x, const VectorRef<Scalar>& y) {
+  assert((x.size() > 1) && "Arrays must have at least 2 elements");
+
+  Index size = x.size();
+  const VectorX<Scalar> h = x.tail(size - 1) - x.head(size - 1);
+  const VectorX<Scalar> slope = secantSlopes(x, y);
+
+  if (size == 2) { return VectorX<Scalar>::Constant(2, slope[0]); }
+
+  VectorX<Scalar> m(size);
+
+  // Weighted harmonic mean of the neighbouring slopes, or 0 at extrema
+  for (Index i = 1; i < size - 1; i++) {
+	if (slope[i - 1] * slope[i] <= 0.0) {
+	  m[i] = 0.0;
+	} else {
+	  Scalar w1 = 2.0 * h[i] + h[i - 1];
+	  Scalar w2 = h[i] + 2.0 * h[i - 1];
+	  m[i] = (w1 + w2) / (w1 / slope[i - 1] + w2 / slope[i]);
+	}
+  }
+
+  // Shape-preserving three-point formula at the ends
+  auto edge = [](Scalar h0, Scalar h1, Scalar s0, Scalar s1) -> Scalar {
+	Scalar d = ((2.0 * h0 + h1) * s0 - h0 * s1) / (h0 + h1);
+	if (d * s0 <= 0.0) { return 0.0; }
+	if (s0 * s1 <= 0.0 && abs(d) > abs(3.0 * s0)) { return 3.0 * s0; }
+	return d;
+  };
+
+  m[0] = edge(h[0], h[1], slope[0], slope[1]);
+  m[size - 1] = edge(h[size - 2], h[size - 3], slope[size - 2], slope[size - 3]);
+
+  // Returns with copy elision
+  return m;
+}
+
+/**
+ * @brief Derivatives of the Akima interpolant.
+ *
+ * @see Akima, H., A new method of interpolation and smooth curve fitting
+ *  based on local procedures. Journal of the ACM, 17(4), 1970.
+ */
+template<typename Scalar>
+VectorX<Scalar> akimaSlopes(const VectorRef<Scalar>& x, const VectorRef<Scalar>& y) {
+  assert((x.size() > 1) && "Arrays must have at least 2 elements");
+
+  Index size = x.size();
+  const VectorX<Scalar> slope = secantSlopes(x, y);
+
+  if (size == 2) { return VectorX<Scalar>::Constant(2, slope[0]); }
+
+  // Secant slopes extended by two on each side by linear extrapolation
+  VectorX<Scalar> s(size + 3);
+  s.segment(2, size - 1) = slope;
+  s[1] = 2.0 * s[2] - s[3];
+  s[0] = 2.0 * s[1] - s[2];
+  s[size + 1] = 2.0 * s[size] - s[size - 1];
+  s[size + 2] = 2.0 * s[size + 1] - s[size];
+
+  VectorX<Scalar> m(size);
+  for (Index i = 0; i < size; i++) {
+	Scalar w1 = abs(s[i + 3] - s[i + 2]);
+	Scalar w2 = abs(s[i + 1] - s[i]);
+
+	m[i] = w1 + w2 > 0.0
+		? (w1 * s[i + 1] + w2 * s[i + 2]) / (w1 + w2)
+		: 0.5 * (s[i + 1] + s[i + 2]);
+  }
+
+  // Returns with copy elision
+  return m;
+}
+
+} // namespace internal
+
+/**
+ * @class SplineInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function with a cubic spline.
+ *
+ * The spline has continuous first and second derivatives. Its derivatives at
+ * the points are found on construction by solving a tridiagonal system in
+ * O(n).
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class SplineInterp1d : public HermiteInterp1d<Scalar> {
+ public:
+  SplineInterp1d(const VectorRef<Scalar>& x,
+				 const VectorRef<Scalar>& y,
+				 SplineBoundary boundary = SplineBoundary::NotAKnot,
+				 bool check_bounds = true);
+
+  SplineInterp1d(const VectorRef<Scalar>& x,
+				 const VectorRef<Scalar>& y,
+				 Scalar dydx_first,
+				 Scalar dydx_last,
+				 bool check_bounds = true);
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing and have at least 2 elements.
+ * @param y Array of y-values representing the dependent variable.
+ * @param boundary Boundary condition, either 'Natural' or 'NotAKnot'.
+ *  Default is 'NotAKnot'.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+SplineInterp1d<Scalar>::SplineInterp1d(const VectorRef<Scalar>& x,
+									   const VectorRef<Scalar>& y,
+									   const SplineBoundary boundary,
+									   const bool check_bounds)
+	: HermiteInterp1d<Scalar>(x, y, internal::splineSlopes<Scalar>(x, y, boundary, 0.0, 0.0), check_bounds) {
+  assert((boundary != SplineBoundary::Clamped) && "Clamped splines need the end derivatives");
+}
+
+/**
+ * Constructs the interpolator with clamped ends.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing and have at least 2 elements.
+ * @param y Array of y-values representing the dependent variable.
+ * @param dydx_first Derivative at the first point.
+ * @param dydx_last Derivative at the last point.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+SplineInterp1d<Scalar>::SplineInterp1d(const VectorRef<Scalar>& x,
+									   const VectorRef<Scalar>& y,
+									   const Scalar dydx_first,
+									   const Scalar dydx_last,
+									   const bool check_bounds)
+	: HermiteInterp1d<Scalar>(x, y,
+							  internal::splineSlopes(x, y, SplineBoundary::Clamped, dydx_first, dydx_last),
+							  check_bounds) {}
+
+/**
+ * @class PchipInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function with a monotone piecewise cubic
+ *  Hermite polynomial (PCHIP).
+ *
+ * The interpolant has a continuous first derivative, is monotone wherever the
+ * data are, and does not overshoot at local extrema.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class PchipInterp1d : public HermiteInterp1d<Scalar> {
+ public:
+  PchipInterp1d(const VectorRef<Scalar>& x,
+				const VectorRef<Scalar>& y,
+				bool check_bounds = true);
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing and have at least 2 elements.
+ * @param y Array of y-values representing the dependent variable.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+PchipInterp1d<Scalar>::PchipInterp1d(const VectorRef<Scalar>& x,
+									   const VectorRef<Scalar>& y,
+									   const bool check_bounds)
+	: HermiteInterp1d<Scalar>(x, y, internal::pchipSlopes(x, y), check_bounds) {}
+
+/**
+ * @class AkimaInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function with the Akima piecewise cubic.
+ *
+ * The derivative at each point depends only on the 2 neighbouring points on
+ * each side, so outliers do not cause oscillations far from them.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class AkimaInterp1d : public HermiteInterp1d<Scalar> {
+ public:
+  AkimaInterp1d(const VectorRef<Scalar>& x,
+				const VectorRef<Scalar>& y,
+				bool check_bounds = true);
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing and have at least 2 elements.
+ * @param y Array of y-values representing the dependent variable.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+AkimaInterp1d<Scalar>::AkimaInterp1d(const VectorRef<Scalar>& x,
+									   const VectorRef<Scalar>& y,
+									   const bool check_bounds)
+	: HermiteInterp1d<Scalar>(x, y, internal::akimaSlopes(x, y), check_bounds) {}
+
+} // namespace nuenv
+
+#endif
@@ -1,10 +1,18 @@
 #ifndef NUENV_INTERPOLATE_INTERP1D_H_
 #define NUENV_INTERPOLATE_INTERP1D_H_
 
+#include "nuenv/src/algorithm/grid.hpp"
+#include "nuenv/src/algorithm/hunt.hpp"
 #include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
 #include "nuenv/src/core/container.hpp"
 #include "nuenv/src/core/math.hpp"
 
+#include <algorithm>
+#include <new>
+#include <ranges>
+#include <type_traits>
+
 namespace nuenv {
 
 /**
@@ -15,24 +23,108 @@ namespace nuenv {
  * This class implements methods whose call uses interpolation to find the value
  * of new points of some function f: 'y = f(x)'.
  *
+ * The slope and growth rate of every segment can optionally be precomputed on
+ * construction, stored next to the segment's 'x' and 'y' values, so that each
+ * evaluation costs one search, one load and one fused multiply-add (plus one
+ * 'exp' for exponential interpolation).
+ *
+ * Evaluation is const and does not modify the interpolator, so a single
+ * instance may be shared by any number of threads through a const reference.
+ * The only mutable search state, the hint of the methods taking a
+ * 'SearchCursor', is held by the caller: each thread should use its own
+ * cursor. Assigning to an interpolator while other threads evaluate it is not
+ * safe.
+ *
+ * By default the table is copied on construction, from any vector with
+ * contiguous storage without an intermediate copy. 'Interp1dView' instead
+ * references caller memory, such as a 'std::vector' or a column of a
+ * 'MatrixSQX' viewed with 'AsVector', which must then outlive it and must not
+ * be modified while it is in use.
+ *
  * @tparam Scalar Scalar type of the numbers.
+ * @tparam Storage Storage of the table, either 'VectorX' to own a copy or
+ *  'VectorView' to reference caller memory.
  */
-template<typename Scalar>
+template<typename Scalar, typename Storage = VectorX<Scalar>>
 class Interp1d {
  public:
-  Interp1d(const VectorX<Scalar>& x,
-		   const VectorX<Scalar>& y,
-		   bool check_bounds = true);
+  static constexpr bool kOwning = std::is_same_v<Storage, VectorX<Scalar>>;
+
+  static_assert(kOwning || std::is_same_v<Storage, VectorView<Scalar>>,
+				"Storage must be either 'VectorX' or 'VectorView'");
+
+  // Owning interpolators copy from any vector, views reference the memory
+  using Source = std::conditional_t<kOwning, VectorRef<Scalar>, VectorView<Scalar>>;
+
+  Interp1d(const Source& x,
+		   const Source& y,
+		   bool check_bounds = true,
+		   bool precompute = false);
+
+  template<SpaceGrid Grid>
+  Interp1d(const Grid& x,
+		   const VectorRef<Scalar>& y,
+		   bool check_bounds = true,
+		   bool precompute = false);
+
+  Interp1d(const Interp1d& other);
 
-  Scalar linear(Scalar x);
+  Interp1d& operator=(const Interp1d& other);
 
-  Scalar exponential(Scalar x);
+  Scalar linear(Scalar x) const;
+
+  Scalar linear(Scalar x, SearchCursor& cursor) const;
+
+  Scalar exponential(Scalar x) const;
+
+  Scalar exponential(Scalar x, SearchCursor& cursor) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  VectorX<Scalar> linear(const Points& x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void linear(const Points& x, VectorX<Scalar>& out) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  VectorX<Scalar> exponential(const Points& x) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void exponential(const Points& x, VectorX<Scalar>& out) const;
 
  private:
-  VectorX<Scalar> x_;
-  VectorX<Scalar> y_;
+  using Block = Eigen::Array<Scalar, 256, 1>;
+
+  // Precomputed segment, aligned so that it never straddles a cache line
+  struct alignas(4 * sizeof(Scalar)) Segment {
+	Scalar x;
+	Scalar y;
+	Scalar slope;
+	Scalar rate;
+  };
+
+  void precompute();
+
+  Scalar linearSegment(size_t index, Scalar x) const;
+
+  Scalar exponentialSegment(size_t index, Scalar x) const;
+
+  template<typename Points, typename Coefficient, typename Kernel>
+  void evaluate(const Points& x,
+				VectorX<Scalar>& out,
+				Scalar Segment::* member,
+				Coefficient coefficient,
+				Kernel kernel) const;
+
+  Storage x_;
+  Storage y_;
   size_t size_;
   bool check_bounds_;
+  SortedIndex<Scalar> index_;
+  VectorT<Segment> segments_;
 };
 
 /**
@@ -45,14 +137,85 @@ class Interp1d {
  * @param y Array of y-values representing the dependent variable.
  * @param check_bounds Indicates whether to check if new points are within the
  *  domain bounds of 'x'.
+ * @param precompute Indicates whether to precompute the slope and growth rate
+ *  of every segment, trading memory for faster evaluation. Default is false.
  */
-template<typename Scalar>
-Interp1d<Scalar>::Interp1d(const VectorX<Scalar>& x,
-						   const VectorX<Scalar>& y,
-						   const bool check_bounds)
-	: x_(x), y_(y), size_(x.size()), check_bounds_(check_bounds) {
+template<typename Scalar, typename Storage>
+Interp1d<Scalar, Storage>::Interp1d(const Source& x,
+									const Source& y,
+									const bool check_bounds,
+									const bool precompute)
+	: x_(x),
+	  y_(y),
+	  size_(x.size()),
+	  check_bounds_(check_bounds),
+	  index_(x_) {
   assert((x.size() > 0 && y.size() > 0) && "Arrays must not be empty");
   assert((x.size() == y.size()) && "Arrays 'x' and 'y' must have same size");
+
+  if (precompute) { this->precompute(); }
+}
+
+/**
+ * Constructs the interpolator over a grid.
+ *
+ * The grid is detected by the search index, so lookups take constant time.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Grid Grid type, such as 'UniformGrid'.
+ *
+ * @param x Grid of x-values representing the independent variable.
+ * @param y Array of y-values representing the dependent variable.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ * @param precompute Indicates whether to precompute the slope and growth rate
+ *  of every segment, trading memory for faster evaluation. Default is false.
+ */
+template<typename Scalar, typename Storage>
+template<SpaceGrid Grid>
+Interp1d<Scalar, Storage>::Interp1d(const Grid& x,
+									const VectorRef<Scalar>& y,
+									const bool check_bounds,
+									const bool precompute)
+	: Interp1d(x.toVector(), y, check_bounds, precompute) {
+  static_assert(kOwning, "Views cannot reference a grid, which has no storage");
+}
+
+/**
+ * @brief Copy constructor.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar, typename Storage>
+Interp1d<Scalar, Storage>::Interp1d(const Interp1d& other)
+	: x_(other.x_),
+	  y_(other.y_),
+	  size_(other.size_),
+	  check_bounds_(other.check_bounds_),
+	  index_(x_),
+	  segments_(other.segments_) {}
+
+/**
+ * @brief Assignment operator.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar, typename Storage>
+Interp1d<Scalar, Storage>& Interp1d<Scalar, Storage>::operator=(const Interp1d& other) {
+  if constexpr (kOwning) {
+	x_ = other.x_;
+	y_ = other.y_;
+  } else {
+	// Assigning to a map would write through it, so re-point it instead
+	new (&x_) Storage(other.x_);
+	new (&y_) Storage(other.y_);
+  }
+  size_ = other.size_;
+  check_bounds_ = other.check_bounds_;
+  index_ = SortedIndex<Scalar>(x_);
+  segments_ = other.segments_;
+
+  return *this;
 }
 
 /**
@@ -64,18 +227,41 @@ Interp1d<Scalar>::Interp1d(const VectorX<Scalar>& x,
  *
  * @return Interpolated value at 'x'.
  */
-template<typename Scalar>
-Scalar Interp1d<Scalar>::linear(Scalar x) {
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::linear(Scalar x) const {
   assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
 
   if (x < x_[0]) { return y_[0]; }
-  else if (x > x_[size_ - 1]) { return y_[size_ - 1]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
 
-  size_t index = SearchSorted<Scalar>(x_, x);
+  size_t index = SearchSorted(index_, x);
 
-  return y_[index]
-	  + ((y_[index + 1] - y_[index]) / (x_[index + 1] - x_[index]))
-		  * (x - x_[index]);
+  return linearSegment(index, x);
+}
+
+/**
+ * @brief Linear interpolation of correlated points.
+ *
+ * Hunts for the segment starting from the one found by the last call with the
+ * same cursor, so sweeping 'x' monotonically takes amortized constant time.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ * @param cursor Search cursor, updated with the segment containing 'x'.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::linear(Scalar x, SearchCursor& cursor) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
+
+  size_t index = cursor.search(x_, x);
+
+  return linearSegment(index, x);
 }
 
 /**
@@ -87,14 +273,240 @@ Scalar Interp1d<Scalar>::linear(Scalar x) {
  *
  * @return Interpolated value at 'x'.
  */
-template<typename Scalar>
-Scalar Interp1d<Scalar>::exponential(Scalar x) {
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::exponential(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
+
+  size_t index = SearchSorted(index_, x);
+
+  return exponentialSegment(index, x);
+}
+
+/**
+ * @brief Exponential interpolation of correlated points.
+ *
+ * Hunts for the segment starting from the one found by the last call with the
+ * same cursor, so sweeping 'x' monotonically takes amortized constant time.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ * @param cursor Search cursor, updated with the segment containing 'x'.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::exponential(Scalar x, SearchCursor& cursor) const {
   assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
 
   if (x < x_[0]) { return y_[0]; }
-  else if (x > x_[size_ - 1]) { return y_[size_ - 1]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
+
+  size_t index = cursor.search(x_, x);
+
+  return exponentialSegment(index, x);
+}
+
+/**
+ * @brief Linear interpolation of many points.
+ *
+ * The segments of all points are found at once, in a single merge pass over
+ * 'x' when the points are sorted, and the interpolation is vectorized.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView', which is read without a copy.
+ *
+ * @param x Points to be interpolated.
+ *
+ * @return Interpolated values at 'x'.
+ */
+template<typename Scalar, typename Storage>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+VectorX<Scalar> Interp1d<Scalar, Storage>::linear(const Points& x) const {
+  VectorX<Scalar> out;
+  linear(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Linear interpolation of many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar, typename Storage>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void Interp1d<Scalar, Storage>::linear(const Points& x, VectorX<Scalar>& out) const {
+  auto slope = [](const auto& x0, const auto& x1, const auto& y0, const auto& y1) {
+	return (y1 - y0) / (x1 - x0);
+  };
+
+  evaluate(x, out, &Segment::slope, slope,
+		   [](const auto& t, const auto& x0, const auto& y0, const auto& c) {
+			 return y0 + c * (t - x0);
+		   });
+}
+
+/**
+ * @brief Exponential interpolation of many points.
+ *
+ * The segments of all points are found at once, in a single merge pass over
+ * 'x' when the points are sorted, and the interpolation is vectorized.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView', which is read without a copy.
+ *
+ * @param x Points to be interpolated.
+ *
+ * @return Interpolated values at 'x'.
+ */
+template<typename Scalar, typename Storage>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+VectorX<Scalar> Interp1d<Scalar, Storage>::exponential(const Points& x) const {
+  VectorX<Scalar> out;
+  exponential(x, out);
+
+  // Returns with copy elision
+  return out;
+}
 
-  size_t index = SearchSorted<Scalar>(x_, x);
+/**
+ * @brief Exponential interpolation of many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar, typename Storage>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void Interp1d<Scalar, Storage>::exponential(const Points& x, VectorX<Scalar>& out) const {
+  auto rate = [](const auto& x0, const auto& x1, const auto& y0, const auto& y1) {
+	return (y1 / y0).log() / (x1 - x0);
+  };
+
+  evaluate(x, out, &Segment::rate, rate,
+		   [](const auto& t, const auto& x0, const auto& y0, const auto& c) {
+			 return y0 * (c * (t - x0)).exp();
+		   });
+}
+
+/**
+ * @brief Interpolate many points with a vectorized kernel.
+ *
+ * The segment bounds of each block of points are gathered into contiguous
+ * arrays, so that the kernel runs over whole SIMD registers. The segment
+ * coefficient is gathered from the precomputed 'member' if available, or else
+ * computed from the bounds. Points out of the domain are then set to the
+ * nearest bound value.
+ */
+template<typename Scalar, typename Storage>
+template<typename Points, typename Coefficient, typename Kernel>
+void Interp1d<Scalar, Storage>::evaluate(const Points& x,
+										VectorX<Scalar>& out,
+										Scalar Segment::* member,
+										Coefficient coefficient,
+										Kernel kernel) const {
+  assert(!(check_bounds_ && std::ranges::any_of(x, [this](Scalar t) {
+	return t < x_[0] && t > x_[size_ - 1];
+  })) && "'x' is out of bounds");
+
+  Index num = std::ranges::ssize(x);
+  out.resize(num);
+
+  if (size_ == 1) {
+	out.setConstant(y_[0]);
+	return;
+  }
+
+  VectorX<Index> index;
+  SearchSorted(index_, x, index);
+
+  const Index last = static_cast<Index>(size_) - 1;
+
+  Block t, x0, x1, y0, y1, c;
+  for (Index begin = 0; begin < num; begin += Block::SizeAtCompileTime) {
+	Index n = min<Index>(Block::SizeAtCompileTime, num - begin);
+
+	if (segments_.empty()) {
+	  for (Index k = 0; k < n; ++k) {
+		Index i = min(index[begin + k], last - 1);
+		t[k] = x[begin + k];
+		x0[k] = x_[i];
+		x1[k] = x_[i + 1];
+		y0[k] = y_[i];
+		y1[k] = y_[i + 1];
+	  }
+
+	  c.head(n) = coefficient(x0.head(n), x1.head(n), y0.head(n), y1.head(n));
+	} else {
+	  for (Index k = 0; k < n; ++k) {
+		const Segment& segment = segments_[min(index[begin + k], last - 1)];
+		t[k] = x[begin + k];
+		x0[k] = segment.x;
+		y0[k] = segment.y;
+		c[k] = segment.*member;
+	  }
+	}
+
+	auto seg = out.segment(begin, n).array();
+	seg = kernel(t.head(n), x0.head(n), y0.head(n), c.head(n));
+	seg = (t.head(n) < x_[0]).select(y_[0], (t.head(n) >= x_[last]).select(y_[last], seg));
+  }
+}
+
+/**
+ * @brief Precompute the slope and growth rate of every segment.
+ */
+template<typename Scalar, typename Storage>
+void Interp1d<Scalar, Storage>::precompute() {
+  segments_.resize(size_ - 1);
+
+  for (size_t i = 0; i + 1 < size_; i++) {
+	Scalar dx = x_[i + 1] - x_[i];
+	segments_[i] = {x_[i], y_[i], (y_[i + 1] - y_[i]) / dx, log(y_[i + 1] / y_[i]) / dx};
+  }
+}
+
+/**
+ * @brief Linear interpolation within the segment starting at 'index'.
+ */
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::linearSegment(size_t index, Scalar x) const {
+  if (!segments_.empty()) {
+	const Segment& segment = segments_[index];
+	return segment.y + segment.slope * (x - segment.x);
+  }
+
+  return y_[index]
+	  + ((y_[index + 1] - y_[index]) / (x_[index + 1] - x_[index]))
+		  * (x - x_[index]);
+}
+
+/**
+ * @brief Exponential interpolation within the segment starting at 'index'.
+ */
+template<typename Scalar, typename Storage>
+Scalar Interp1d<Scalar, Storage>::exponentialSegment(size_t index, Scalar x) const {
+  if (!segments_.empty()) {
+	const Segment& segment = segments_[index];
+	return segment.y * exp(segment.rate * (x - segment.x));
+  }
 
   Scalar zeta = log(y_[index + 1] / y_[index])
 	  / (x_[index + 1] - x_[index]);
@@ -102,6 +514,9 @@ Scalar Interp1d<Scalar>::exponential(Scalar x) {
   return y_[index] * exp(zeta * (x - x_[index]));
 }
 
+template<typename Scalar>
+using Interp1dView = Interp1d<Scalar, VectorView<Scalar>>;
+
 }
 
 #endif
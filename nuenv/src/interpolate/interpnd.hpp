@@ -0,0 +1,267 @@
+#ifndef NUENV_INTERPOLATE_INTERPND_H_
+#define NUENV_INTERPOLATE_INTERPND_H_
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <array>
+
+namespace nuenv {
+
+/**
+ * @class InterpNd
+ *
+ * @brief Interpolate an N-dimensional function tabulated on a regular grid.
+ *
+ * The grid is the tensor product of one sorted axis per dimension, and the
+ * values are stored flat in row-major order, so that the last axis varies
+ * fastest. Each query costs one search per axis, each axis having its own
+ * search index, and the 2^dim corners of the enclosing cell are blended with
+ * a recursion that is fully unrolled at compile time.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam dim Number of dimensions.
+ */
+template<typename Scalar, Index dim>
+class InterpNd {
+ public:
+  static_assert(dim > 0, "Number of dimensions must be positive");
+
+  using Point = VectorX_s<Scalar, dim>;
+
+  InterpNd(const std::array<VectorX<Scalar>, dim>& axes,
+		   const VectorX<Scalar>& values,
+		   bool check_bounds = true);
+
+  InterpNd(const InterpNd& other);
+
+  InterpNd& operator=(const InterpNd& other);
+
+  Scalar linear(const Point& x) const;
+
+  VectorX<Scalar> linear(const MatrixSQX<Scalar>& x) const;
+
+  void linear(const MatrixSQX<Scalar>& x, VectorX<Scalar>& out) const;
+
+ private:
+  void buildIndexes();
+
+  Scalar locate(Index axis, Index index, Scalar x, Index& offset) const;
+
+  template<Index axis>
+  Scalar blend(Index offset, const Scalar* weights) const;
+
+  std::array<VectorX<Scalar>, dim> axes_;
+  std::array<Index, dim> strides_;
+  VectorX<Scalar> values_;
+  bool check_bounds_;
+  VectorT<SortedIndex<Scalar>> indexes_;
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam dim Number of dimensions.
+ *
+ * @param axes Array of grid coordinates along each axis, each must be
+ *  increasing and have at least 2 elements.
+ * @param values Array of function values at the grid points, in row-major
+ *  order. Its size must be the product of the sizes of the axes.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of the grid.
+ */
+template<typename Scalar, Index dim>
+InterpNd<Scalar, dim>::InterpNd(const std::array<VectorX<Scalar>, dim>& axes,
+								const VectorX<Scalar>& values,
+								const bool check_bounds)
+	: axes_(axes), values_(values), check_bounds_(check_bounds) {
+  Index stride = 1;
+  for (Index d = dim - 1; d >= 0; d--) {
+	assert((axes_[d].size() > 1) && "Axes must have at least 2 elements");
+
+	strides_[d] = stride;
+	stride *= axes_[d].size();
+  }
+
+  assert((values.size() == stride) && "Number of values must match the grid size");
+
+  buildIndexes();
+}
+
+/**
+ * @brief Copy constructor.
+ *
+ * The search indexes are rebuilt over the copied axes.
+ */
+template<typename Scalar, Index dim>
+InterpNd<Scalar, dim>::InterpNd(const InterpNd& other)
+	: axes_(other.axes_),
+	  strides_(other.strides_),
+	  values_(other.values_),
+	  check_bounds_(other.check_bounds_) {
+  buildIndexes();
+}
+
+/**
+ * @brief Assignment operator.
+ *
+ * The search indexes are rebuilt over the copied axes.
+ */
+template<typename Scalar, Index dim>
+InterpNd<Scalar, dim>& InterpNd<Scalar, dim>::operator=(const InterpNd& other) {
+  axes_ = other.axes_;
+  strides_ = other.strides_;
+  values_ = other.values_;
+  check_bounds_ = other.check_bounds_;
+  buildIndexes();
+
+  return *this;
+}
+
+/**
+ * @brief Multilinear interpolation.
+ *
+ * Coordinates out of the grid are clamped onto its bounds.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam dim Number of dimensions.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar, Index dim>
+Scalar InterpNd<Scalar, dim>::linear(const Point& x) const {
+  Index offset = 0;
+  Scalar weights[dim];
+
+  for (Index d = 0; d < dim; d++) {
+	weights[d] = locate(d, SearchSorted(indexes_[d], x[d]), x[d], offset);
+  }
+
+  return blend<0>(offset, weights);
+}
+
+/**
+ * @brief Multilinear interpolation of many points.
+ *
+ * The cells of all points are found with one batched search per axis, which
+ * walks sorted coordinates over the axis in a single merge pass.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam dim Number of dimensions.
+ *
+ * @param x Points to be interpolated, one per column.
+ *
+ * @return Interpolated values at 'x'.
+ */
+template<typename Scalar, Index dim>
+VectorX<Scalar> InterpNd<Scalar, dim>::linear(const MatrixSQX<Scalar>& x) const {
+  VectorX<Scalar> out;
+  linear(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Multilinear interpolation of many points into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam dim Number of dimensions.
+ *
+ * @param x Points to be interpolated, one per column.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar, Index dim>
+void InterpNd<Scalar, dim>::linear(const MatrixSQX<Scalar>& x, VectorX<Scalar>& out) const {
+  assert((x.rows() == dim) && "Points must have one row per dimension");
+
+  Index num = x.cols();
+
+  VectorX<Index> offsets = VectorX<Index>::Zero(num);
+  MatrixSQX<Scalar> weights(dim, num);
+
+  VectorX<Scalar> coords;
+  VectorX<Index> index;
+  for (Index d = 0; d < dim; d++) {
+	coords = x.row(d).transpose();
+	SearchSorted(indexes_[d], coords, index);
+
+	for (Index j = 0; j < num; j++) {
+	  weights(d, j) = locate(d, index[j], coords[j], offsets[j]);
+	}
+  }
+
+  out.resize(num);
+  for (Index j = 0; j < num; j++) {
+	out[j] = blend<0>(offsets[j], weights.col(j).data());
+  }
+}
+
+/**
+ * @brief Search indexes over the axes.
+ */
+template<typename Scalar, Index dim>
+void InterpNd<Scalar, dim>::buildIndexes() {
+  indexes_.clear();
+  indexes_.reserve(dim);
+  for (Index d = 0; d < dim; d++) { indexes_.emplace_back(axes_[d]); }
+}
+
+/**
+ * @brief Locate a coordinate within the cell starting at 'index' of an axis.
+ *
+ * @param axis Axis of the coordinate.
+ * @param index Result of searching the axis for the coordinate.
+ * @param x Coordinate.
+ * @param offset Flat offset, incremented by that of the cell along the axis.
+ *
+ * @return Weight of the upper side of the cell, clamped to '[0, 1]'.
+ */
+template<typename Scalar, Index dim>
+Scalar InterpNd<Scalar, dim>::locate(Index axis, Index index, Scalar x, Index& offset) const {
+  const VectorX<Scalar>& a = axes_[axis];
+  const Index last = a.size() - 1;
+
+  assert(!(check_bounds_ && x < a[0] && x > a[last]) && "'x' is out of bounds");
+
+  index = min(index, last - 1);
+  offset += index * strides_[axis];
+
+  Scalar w = (x - a[index]) / (a[index + 1] - a[index]);
+
+  return min<Scalar>(max<Scalar>(w, 0.0), 1.0);
+}
+
+/**
+ * @brief Blend the corners of a cell along the axes from 'axis' on.
+ *
+ * Recurses at compile time, so the loop over the 2^dim corners is unrolled.
+ */
+template<typename Scalar, Index dim>
+template<Index axis>
+Scalar InterpNd<Scalar, dim>::blend(Index offset, const Scalar* weights) const {
+  if constexpr (axis == dim) {
+	return values_[offset];
+  } else {
+	Scalar lower = blend<axis + 1>(offset, weights);
+	Scalar upper = blend<axis + 1>(offset + strides_[axis], weights);
+
+	return lower + weights[axis] * (upper - lower);
+  }
+}
+
+template<typename Scalar>
+using Interp2d = InterpNd<Scalar, 2>;
+
+template<typename Scalar>
+using Interp3d = InterpNd<Scalar, 3>;
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef NUENV_INTERPOLATE_MAPPEDTABLE_H_
+#define NUENV_INTERPOLATE_MAPPEDTABLE_H_
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#if !__has_include(<sys/mman.h>)
+#error "MappedTable requires POSIX memory mapping ('sys/mman.h')"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace nuenv {
+
+namespace internal {
+
+/**
+ * Binary table file layout, in native byte order:
+ *
+ * - A 64-byte header, 'TableHeader'.
+ * - 'cols' columns of 'rows' scalars each. Every column starts at a multiple
+ *   of 64 bytes from the start of the file, 'stride' bytes after the previous
+ *   one, and is zero-padded up to the next column.
+ */
+struct TableHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t dtype;
+  uint32_t reserved[3];
+  uint64_t rows;
+  uint64_t cols;
+  uint64_t offset;
+  uint64_t stride;
+};
+
+struct ConstsTable {
+  static constexpr char kMagic[8] = {'N', 'U', 'E', 'N', 'V', 'T', 'B', 'L'};
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kByteOrder = 0x01020304;
+  static constexpr uint64_t kAlignment = 64;
+};
+
+static_assert(sizeof(TableHeader) == ConstsTable::kAlignment, "Table header must fill one aligned block");
+
+/**
+ * @brief Code of the scalar type stored in a table, 0 if unsupported.
+ */
+template<typename Scalar>
+constexpr uint32_t tableDtype() {
+  if constexpr (std::is_same_v<Scalar, float>) { return 1; }
+  else if constexpr (std::is_same_v<Scalar, double>) { return 2; }
+  else { return 0; }
+}
+
+} // namespace internal
+
+/**
+ * @brief Write columns of scalars to a binary table file.
+ *
+ * The file can then be memory-mapped by 'MappedTable' and used without any
+ * parsing or copying.
+ *
+ * @tparam Scalar Scalar type of the numbers, 'float' or 'double'.
+ *
+ * @param path Path of the file, overwritten if it exists.
+ * @param columns Matrix whose columns are written, such as 'x' followed by
+ *  one or more 'y' columns.
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+template<typename Scalar>
+void WriteTable(const std::string& path, const MatrixSQX<Scalar>& columns) {
+  using Consts = internal::ConstsTable;
+
+  static_assert(internal::tableDtype<Scalar>() != 0, "Unsupported scalar type");
+
+  const uint64_t bytes = columns.rows() * sizeof(Scalar);
+
+  internal::TableHeader header {};
+  std::memcpy(header.magic, Consts::kMagic, sizeof(header.magic));
+  header.version = Consts::kVersion;
+  header.byte_order = Consts::kByteOrder;
+  header.dtype = internal::tableDtype<Scalar>();
+  header.rows = columns.rows();
+  header.cols = columns.cols();
+  header.offset = Consts::kAlignment;
+  header.stride = (bytes + Consts::kAlignment - 1) / Consts::kAlignment * Consts::kAlignment;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  const VectorT<char> padding(header.stride - bytes, 0);
+  for (Index j = 0; j < columns.cols(); j++) {
+	file.write(reinterpret_cast<const char*>(columns.col(j).data()), static_cast<std::streamsize>(bytes));
+	file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+  }
+
+  if (!file) { throw std::runtime_error("Cannot write table '" + path + "'"); }
+}
+
+/**
+ * @class MappedTable
+ *
+ * @brief Read-only memory mapping of a binary table file.
+ *
+ * The columns are exposed in place as aligned 'Eigen::Map's, so opening a
+ * table takes constant time whatever its size, and processes mapping the same
+ * file share its physical pages. The maps are valid while the table is alive.
+ *
+ * Requires POSIX memory mapping, so this header is not part of the
+ * 'nuenv/interpolate' umbrella header and must be included on its own.
+ *
+ * @tparam Scalar Scalar type of the numbers, must match the one of the file.
+ */
+template<typename Scalar>
+class MappedTable {
+ public:
+  using Column = Eigen::Map<const VectorX<Scalar>, Eigen::Aligned64>;
+
+  explicit MappedTable(const std::string& path);
+
+  MappedTable(const MappedTable&) = delete;
+
+  MappedTable& operator=(const MappedTable&) = delete;
+
+  ~MappedTable();
+
+  Column column(Index j) const;
+
+  Index rows() const { return static_cast<Index>(header_->rows); }
+
+  Index cols() const { return static_cast<Index>(header_->cols); }
+
+ private:
+  void* data_;
+  size_t bytes_;
+  const internal::TableHeader* header_;
+};
+
+/**
+ * Maps a table file.
+ *
+ * @param path Path of the file, written by 'WriteTable'.
+ *
+ * @throws std::runtime_error If the file cannot be mapped or is not a valid
+ *  table of 'Scalar'.
+ */
+template<typename Scalar>
+MappedTable<Scalar>::MappedTable(const std::string& path)
+	: data_(MAP_FAILED), bytes_(0), header_(nullptr) {
+  using Consts = internal::ConstsTable;
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) { throw std::runtime_error("Cannot open table '" + path + "'"); }
+
+  struct stat info {};
+  if (::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(internal::TableHeader)) {
+	bytes_ = static_cast<size_t>(info.st_size);
+	data_ = ::mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0);
+  }
+
+  // The mapping stays valid after closing the file
+  ::close(fd);
+
+  if (data_ == MAP_FAILED) { throw std::runtime_error("Cannot map table '" + path + "'"); }
+
+  header_ = static_cast<const internal::TableHeader*>(data_);
+
+  const char* error = nullptr;
+  if (std::memcmp(header_->magic, Consts::kMagic, sizeof(Consts::kMagic)) != 0) {
+	error = "not a table";
+  } else if (header_->version != Consts::kVersion) {
+	error = "unsupported version";
+  } else if (header_->byte_order != Consts::kByteOrder) {
+	error = "wrong byte order";
+  } else if (header_->dtype != internal::tableDtype<Scalar>()) {
+	error = "wrong scalar type";
+  } else if (header_->offset % Consts::kAlignment != 0 || header_->stride % Consts::kAlignment != 0) {
+	error = "corrupt layout";
+  } else if (header_->offset > bytes_ || header_->rows > header_->stride / sizeof(Scalar)
+	  || (header_->stride > 0 && header_->cols > (bytes_ - header_->offset) / header_->stride)
+	  || header_->rows > static_cast<uint64_t>(numeric_limits<Index>::max())
+	  || header_->cols > static_cast<uint64_t>(numeric_limits<Index>::max())) {
+	// Bounds checked by division, so no product of the header fields can wrap
+	error = "corrupt layout";
+  }
+
+  if (error) {
+	::munmap(data_, bytes_);
+	throw std::runtime_error("Invalid table '" + path + "': " + error);
+  }
+}
+
+template<typename Scalar>
+MappedTable<Scalar>::~MappedTable() {
+  ::munmap(data_, bytes_);
+}
+
+/**
+ * @brief Column of the table, mapped in place.
+ *
+ * @param j Index of the column.
+ */
+template<typename Scalar>
+typename MappedTable<Scalar>::Column MappedTable<Scalar>::column(Index j) const {
+  assert((j >= 0 && j < cols()) && "Column out of range");
+
+  const char* begin = static_cast<const char*>(data_) + header_->offset + j * header_->stride;
+
+  return Column(reinterpret_cast<const Scalar*>(begin), rows());
+}
+
+/**
+ * @class MappedInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function tabulated in a mapped table.
+ *
+ * Works directly on the columns of a 'MappedTable', without copying them.
+ * The table must outlive the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class MappedInterp1d {
+ public:
+  MappedInterp1d(const MappedTable<Scalar>& table,
+				 Index x_col = 0,
+				 Index y_col = 1,
+				 bool check_bounds = true);
+
+  Scalar linear(Scalar x) const;
+
+  void linear(const VectorX<Scalar>& x, VectorX<Scalar>& out) const;
+
+  Scalar exponential(Scalar x) const;
+
+  void exponential(const VectorX<Scalar>& x, VectorX<Scalar>& out) const;
+
+ private:
+  using Column = typename MappedTable<Scalar>::Column;
+
+  void segments(const VectorX<Scalar>& x, VectorX<Index>& index) const;
+
+  Scalar linearSegment(Index index, Scalar x) const;
+
+  Scalar exponentialSegment(Index index, Scalar x) const;
+
+  Column x_;
+  Column y_;
+  Index size_;
+  bool check_bounds_;
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param table Mapped table.
+ * @param x_col Column of x-values representing the independent variable,
+ *  must be increasing. Default is 0.
+ * @param y_col Column of y-values representing the dependent variable.
+ *  Default is 1.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+MappedInterp1d<Scalar>::MappedInterp1d(const MappedTable<Scalar>& table,
+									   const Index x_col,
+									   const Index y_col,
+									   const bool check_bounds)
+	: x_(table.column(x_col)),
+	  y_(table.column(y_col)),
+	  size_(table.rows()),
+	  check_bounds_(check_bounds) {
+  assert((size_ > 0) && "Table must not be empty");
+}
+
+/**
+ * @brief Linear interpolation.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar>
+Scalar MappedInterp1d<Scalar>::linear(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
+
+  return linearSegment(internal::binarySearch(x_, x), x);
+}
+
+/**
+ * @brief Linear interpolation of many points into a buffer.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar>
+void MappedInterp1d<Scalar>::linear(const VectorX<Scalar>& x, VectorX<Scalar>& out) const {
+  VectorX<Index> index;
+  segments(x, index);
+
+  out.resize(x.size());
+  for (Index i = 0; i < x.size(); i++) {
+	if (x[i] < x_[0]) { out[i] = y_[0]; }
+	else if (x[i] >= x_[size_ - 1]) { out[i] = y_[size_ - 1]; }
+	else { out[i] = linearSegment(index[i], x[i]); }
+  }
+}
+
+/**
+ * @brief Exponential interpolation.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar>
+Scalar MappedInterp1d<Scalar>::exponential(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[size_ - 1]) { return y_[size_ - 1]; }
+
+  return exponentialSegment(internal::binarySearch(x_, x), x);
+}
+
+/**
+ * @brief Exponential interpolation of many points into a buffer.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values at 'x'. Resized to the number of points.
+ */
+template<typename Scalar>
+void MappedInterp1d<Scalar>::exponential(const VectorX<Scalar>& x, VectorX<Scalar>& out) const {
+  VectorX<Index> index;
+  segments(x, index);
+
+  out.resize(x.size());
+  for (Index i = 0; i < x.size(); i++) {
+	if (x[i] < x_[0]) { out[i] = y_[0]; }
+	else if (x[i] >= x_[size_ - 1]) { out[i] = y_[size_ - 1]; }
+	else { out[i] = exponentialSegment(index[i], x[i]); }
+  }
+}
+
+/**
+ * @brief Find the segments of many points, in a single merge pass over 'x'
+ *  when the points are sorted.
+ */
+template<typename Scalar>
+void MappedInterp1d<Scalar>::segments(const VectorX<Scalar>& x, VectorX<Index>& index) const {
+  assert(!(check_bounds_ && (x.array() < x_[0] && x.array() > x_[size_ - 1]).any())
+			 && "'x' is out of bounds");
+
+  Index num = x.size();
+  index.resize(num);
+
+  bool merge = num * static_cast<Index>(log2(size_) + 1) >= size_ + num;
+
+  if (merge && internal::isMergeable(x)) {
+	internal::mergeSearch(x_, x, index);
+  } else {
+	for (Index i = 0; i < num; i++) { index[i] = internal::binarySearch(x_, x[i]); }
+  }
+}
+
+/**
+ * @brief Linear interpolation within the segment starting at 'index'.
+ */
+template<typename Scalar>
+Scalar MappedInterp1d<Scalar>::linearSegment(Index index, Scalar x) const {
+  return y_[index]
+	  + ((y_[index + 1] - y_[index]) / (x_[index + 1] - x_[index]))
+		  * (x - x_[index]);
+}
+
+/**
+ * @brief Exponential interpolation within the segment starting at 'index'.
+ */
+template<typename Scalar>
+Scalar MappedInterp1d<Scalar>::exponentialSegment(Index index, Scalar x) const {
+  Scalar zeta = log(y_[index + 1] / y_[index])
+	  / (x_[index + 1] - x_[index]);
+
+  return y_[index] * exp(zeta * (x - x_[index]));
+}
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,289 @@
+#ifndef NUENV_INTERPOLATE_MULTIINTERP1D_H_
+#define NUENV_INTERPOLATE_MULTIINTERP1D_H_
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <ranges>
+
+namespace nuenv {
+
+/**
+ * @class MultiInterp1d
+ *
+ * @brief Interpolate many 1-dimensional functions of the same variable.
+ *
+ * The functions, or channels, share a single copy of 'x' and a single search
+ * per query. Their values are stored row-major, so that the values of all
+ * channels at a point are contiguous and each query reads two rows. The
+ * table is read from any contiguous vector and column-major matrix, or block
+ * of one, without an intermediate copy.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ */
+template<typename Scalar>
+class MultiInterp1d {
+ public:
+  MultiInterp1d(const VectorRef<Scalar>& x,
+				const MatrixRef<Scalar>& y,
+				bool check_bounds = true);
+
+  MultiInterp1d(const MultiInterp1d& other);
+
+  MultiInterp1d& operator=(const MultiInterp1d& other);
+
+  VectorX<Scalar> linear(Scalar x) const;
+
+  void linear(Scalar x, VectorX<Scalar>& out) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void linear(const Points& x, MatrixRowX<Scalar>& out) const;
+
+  VectorX<Scalar> exponential(Scalar x) const;
+
+  void exponential(Scalar x, VectorX<Scalar>& out) const;
+
+  template<std::ranges::random_access_range Points>
+  requires std::ranges::sized_range<Points>
+  void exponential(const Points& x, MatrixRowX<Scalar>& out) const;
+
+  Index channels() const { return y_.cols(); }
+
+ private:
+  template<typename Out>
+  void linearAt(Index index, Scalar x, Out&& out) const;
+
+  template<typename Out>
+  void exponentialAt(Index index, Scalar x, Out&& out) const;
+
+  Index segment(Scalar x) const;
+
+  VectorX<Scalar> x_;
+  MatrixRowX<Scalar> y_;
+  size_t size_;
+  bool check_bounds_;
+  SortedIndex<Scalar> index_;
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing.
+ * @param y Matrix of y-values representing the dependent variables, one
+ *  column per channel and one row per element of 'x'.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar>
+MultiInterp1d<Scalar>::MultiInterp1d(const VectorRef<Scalar>& x,
+									 const MatrixRef<Scalar>& y,
+									 const bool check_bounds)
+	: x_(x),
+	  y_(y),
+	  size_(x.size()),
+	  check_bounds_(check_bounds),
+	  index_(x_) {
+  assert((x.size() > 0 && y.size() > 0) && "Arrays must not be empty");
+  assert((x.size() == y.rows()) && "'y' must have one row per element of 'x'");
+}
+
+/**
+ * @brief Copy constructor.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar>
+MultiInterp1d<Scalar>::MultiInterp1d(const MultiInterp1d& other)
+	: x_(other.x_),
+	  y_(other.y_),
+	  size_(other.size_),
+	  check_bounds_(other.check_bounds_),
+	  index_(x_) {}
+
+/**
+ * @brief Assignment operator.
+ *
+ * The search index is rebuilt over the copied 'x' array.
+ */
+template<typename Scalar>
+MultiInterp1d<Scalar>& MultiInterp1d<Scalar>::operator=(const MultiInterp1d& other) {
+  x_ = other.x_;
+  y_ = other.y_;
+  size_ = other.size_;
+  check_bounds_ = other.check_bounds_;
+  index_ = SortedIndex<Scalar>(x_);
+
+  return *this;
+}
+
+/**
+ * @brief Linear interpolation of all channels.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value of each channel at 'x'.
+ */
+template<typename Scalar>
+VectorX<Scalar> MultiInterp1d<Scalar>::linear(Scalar x) const {
+  VectorX<Scalar> out;
+  linear(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Linear interpolation of all channels into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ * @param out Interpolated value of each channel at 'x'. Resized to the number
+ *  of channels.
+ */
+template<typename Scalar>
+void MultiInterp1d<Scalar>::linear(Scalar x, VectorX<Scalar>& out) const {
+  out.resize(channels());
+  linearAt(segment(x), x, out.transpose());
+}
+
+/**
+ * @brief Linear interpolation of all channels at many points.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView'.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values, one row per point and one column per
+ *  channel. Resized accordingly. Row-major, so that each point writes a
+ *  contiguous row.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void MultiInterp1d<Scalar>::linear(const Points& x, MatrixRowX<Scalar>& out) const {
+  VectorX<Index> index;
+  SearchSorted(index_, x, index);
+
+  Index num = std::ranges::ssize(x);
+  out.resize(num, channels());
+  for (Index i = 0; i < num; i++) {
+	linearAt(index[i], x[i], out.row(i));
+  }
+}
+
+/**
+ * @brief Exponential interpolation of all channels.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value of each channel at 'x'.
+ */
+template<typename Scalar>
+VectorX<Scalar> MultiInterp1d<Scalar>::exponential(Scalar x) const {
+  VectorX<Scalar> out;
+  exponential(x, out);
+
+  // Returns with copy elision
+  return out;
+}
+
+/**
+ * @brief Exponential interpolation of all channels into a buffer.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ *
+ * @param x Point to be interpolated.
+ * @param out Interpolated value of each channel at 'x'. Resized to the number
+ *  of channels.
+ */
+template<typename Scalar>
+void MultiInterp1d<Scalar>::exponential(Scalar x, VectorX<Scalar>& out) const {
+  out.resize(channels());
+  exponentialAt(segment(x), x, out.transpose());
+}
+
+/**
+ * @brief Exponential interpolation of all channels at many points.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam Points Random-access range of points, such as a 'VectorX' or a
+ *  lazy view like 'LinearSpaceView'.
+ *
+ * @param x Points to be interpolated.
+ * @param out Interpolated values, one row per point and one column per
+ *  channel. Resized accordingly. Row-major, so that each point writes a
+ *  contiguous row.
+ */
+template<typename Scalar>
+template<std::ranges::random_access_range Points>
+requires std::ranges::sized_range<Points>
+void MultiInterp1d<Scalar>::exponential(const Points& x, MatrixRowX<Scalar>& out) const {
+  VectorX<Index> index;
+  SearchSorted(index_, x, index);
+
+  Index num = std::ranges::ssize(x);
+  out.resize(num, channels());
+  for (Index i = 0; i < num; i++) {
+	exponentialAt(index[i], x[i], out.row(i));
+  }
+}
+
+/**
+ * @brief Find the segment containing 'x'.
+ */
+template<typename Scalar>
+Index MultiInterp1d<Scalar>::segment(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[size_ - 1]) && "'x' is out of bounds");
+
+  return SearchSorted(index_, x);
+}
+
+/**
+ * @brief Linear interpolation of all channels within the segment starting at
+ *  'index', vectorized across channels.
+ */
+template<typename Scalar>
+template<typename Out>
+void MultiInterp1d<Scalar>::linearAt(Index index, Scalar x, Out&& out) const {
+  const Index last = static_cast<Index>(size_) - 1;
+
+  if (x < x_[0]) { out = y_.row(0); return; }
+  else if (x >= x_[last]) { out = y_.row(last); return; }
+
+  Scalar w = (x - x_[index]) / (x_[index + 1] - x_[index]);
+  out = y_.row(index) + w * (y_.row(index + 1) - y_.row(index));
+}
+
+/**
+ * @brief Exponential interpolation of all channels within the segment
+ *  starting at 'index', vectorized across channels.
+ */
+template<typename Scalar>
+template<typename Out>
+void MultiInterp1d<Scalar>::exponentialAt(Index index, Scalar x, Out&& out) const {
+  const Index last = static_cast<Index>(size_) - 1;
+
+  if (x < x_[0]) { out = y_.row(0); return; }
+  else if (x >= x_[last]) { out = y_.row(last); return; }
+
+  Scalar w = (x - x_[index]) / (x_[index + 1] - x_[index]);
+  out = y_.row(index).array()
+	  * (w * (y_.row(index + 1).array() / y_.row(index).array()).log()).exp();
+}
+
+} // namespace nuenv
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef NUENV_INTERPOLATE_STATICINTERP1D_H_
+#define NUENV_INTERPOLATE_STATICINTERP1D_H_
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/ctypes.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <array>
+#include <cassert>
+#include <utility>
+
+namespace nuenv {
+
+/**
+ * @class StaticInterp1d
+ *
+ * @brief Interpolate a 1-dimensional function tabulated at a fixed number of
+ *  points known at compile time.
+ *
+ * The table is held by value in 'std::array's, so it lives on the stack or in
+ * static storage and never allocates. Linear interpolation is 'constexpr',
+ * so tables known at compile time can be evaluated at compile time too.
+ *
+ * The segment of a point is found by counting the interior points not greater
+ * than it, a branchless search whose loop is fully unrolled for every 'N',
+ * which beats a binary search for the small tables this class is meant for.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam N Number of points, at least 2.
+ */
+template<typename Scalar, size_t N>
+class StaticInterp1d {
+ public:
+  static_assert(N >= 2, "Table must have at least 2 points");
+
+  constexpr StaticInterp1d(const std::array<Scalar, N>& x,
+						   const std::array<Scalar, N>& y,
+						   bool check_bounds = true);
+
+  template<typename DerivedX, typename DerivedY>
+  StaticInterp1d(const Eigen::MatrixBase<DerivedX>& x,
+				 const Eigen::MatrixBase<DerivedY>& y,
+				 bool check_bounds = true);
+
+  constexpr Scalar linear(Scalar x) const;
+
+  Scalar exponential(Scalar x) const;
+
+  constexpr Index search(Scalar x) const;
+
+ private:
+  std::array<Scalar, N> x_;
+  std::array<Scalar, N> y_;
+  bool check_bounds_;
+};
+
+/**
+ * Constructs the interpolator.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam N Number of points.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing.
+ * @param y Array of y-values representing the dependent variable.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar, size_t N>
+constexpr StaticInterp1d<Scalar, N>::StaticInterp1d(const std::array<Scalar, N>& x,
+													const std::array<Scalar, N>& y,
+													const bool check_bounds)
+	: x_(x), y_(y), check_bounds_(check_bounds) {}
+
+/**
+ * Constructs the interpolator from fixed-size vectors, such as 'VectorX_s'.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam N Number of points.
+ *
+ * @param x Array of x-values representing the independent variable,
+ *  must be increasing.
+ * @param y Array of y-values representing the dependent variable.
+ * @param check_bounds Indicates whether to check if new points are within the
+ *  domain bounds of 'x'.
+ */
+template<typename Scalar, size_t N>
+template<typename DerivedX, typename DerivedY>
+StaticInterp1d<Scalar, N>::StaticInterp1d(const Eigen::MatrixBase<DerivedX>& x,
+										  const Eigen::MatrixBase<DerivedY>& y,
+										  const bool check_bounds)
+	: x_(), y_(), check_bounds_(check_bounds) {
+  static_assert(DerivedX::SizeAtCompileTime == N && DerivedY::SizeAtCompileTime == N,
+				"Vectors must have 'N' elements");
+
+  for (size_t i = 0; i < N; i++) {
+	x_[i] = x[i];
+	y_[i] = y[i];
+  }
+}
+
+/**
+ * @brief Linear interpolation.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam N Number of points.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar, size_t N>
+constexpr Scalar StaticInterp1d<Scalar, N>::linear(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[N - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[N - 1]) { return y_[N - 1]; }
+
+  Index i = search(x);
+
+  return y_[i] + ((y_[i + 1] - y_[i]) / (x_[i + 1] - x_[i])) * (x - x_[i]);
+}
+
+/**
+ * @brief Exponential interpolation.
+ *
+ * @tparam Scalar Scalar type of the numbers.
+ * @tparam N Number of points.
+ *
+ * @param x Point to be interpolated.
+ *
+ * @return Interpolated value at 'x'.
+ */
+template<typename Scalar, size_t N>
+Scalar StaticInterp1d<Scalar, N>::exponential(Scalar x) const {
+  assert(!(check_bounds_ && x < x_[0] && x > x_[N - 1]) && "'x' is out of bounds");
+
+  if (x < x_[0]) { return y_[0]; }
+  else if (x >= x_[N - 1]) { return y_[N - 1]; }
+
+  Index i = search(x);
+  Scalar zeta = log(y_[i + 1] / y_[i]) / (x_[i + 1] - x_[i]);
+
+  return y_[i] * exp(zeta * (x - x_[i]));
+}
+
+/**
+ * @brief Find the segment containing a value.
+ *
+ * @param x Value to search for.
+ *
+ * @return Index 'i' of the table such that 'x_i <= x < x_(i + 1)', clamped to the
+ *  segments of the table.
+ */
+template<typename Scalar, size_t N>
+constexpr Index StaticInterp1d<Scalar, N>::search(Scalar x) const {
+  // Count the interior points not greater than 'x', unrolled by the fold
+  return [&]<size_t... I>(std::index_sequence<I...>) {
+	return (Index {0} + ... + static_cast<Index>(!(x < x_[I + 1])));
+  }(std::make_index_sequence<N - 2> {});
+}
+
+} // namespace nuenv
+
+#endif
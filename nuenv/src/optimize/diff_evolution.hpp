@@ -1,6 +1,7 @@
 #ifndef NUENV_OPTIMIZE_DIFFEVOLUTION_H_
 #define NUENV_OPTIMIZE_DIFFEVOLUTION_H_
 
+#include "nuenv/src/algorithm/low_discrepancy.hpp"
 #include "nuenv/src/core/container.hpp"
 #include "nuenv/src/core/lambda.hpp"
 #include "nuenv/src/core/math.hpp"
@@ -25,15 +26,28 @@ namespace nuenv {
  *
  * @tparam Scalar Scalar type of the numbers.
  * @tparam ScalarField Scalar field type.
+ * @tparam Fitness Type of the objective function. Default is a 'Lambda'; a
+ *  lambda type lets its calls be inlined, and a 'FunctionRef' avoids owning
+ *  a copy of it.
+ * @tparam Constraints Type of the constraints function. Default is a 'Lambda',
+ *  which is also required to use the default of no constraints.
  *
  * @see Lampinen, J., A constraint handling approach for the differential evolution algorithm. Proceedings of the 2002 Congress on Evolutionary Computation. CEC’02 (Cat. No. 02TH8600). Vol. 2. IEEE, 2002.
  */
-template<typename Scalar, typename ScalarField>
+template<typename Scalar,
+		 typename ScalarField,
+		 typename Fitness = Lambda<Scalar(ScalarField)>,
+		 typename Constraints = Lambda<Scalar(ScalarField)>>
 class DiffEvolution {
  public:
-  DiffEvolution(Lambda<Scalar(ScalarField)> fitness,
+  static_assert(Callable<Fitness, Scalar, ScalarField>,
+				"Fitness must be callable with a 'ScalarField' and return a 'Scalar'");
+  static_assert(Callable<Constraints, Scalar, ScalarField>,
+				"Constraints must be callable with a 'ScalarField' and return a 'Scalar'");
+
+  DiffEvolution(Fitness fitness,
 				VectorT<Vector2X<Scalar>> bounds,
-				Lambda<Scalar(ScalarField)> constraints =
+				Constraints constraints =
 				[](ScalarField /*x*/) { return 0.0; },
 				size_t maxiter = 1000,
 				size_t breakafter = 100,
@@ -59,10 +73,10 @@ class DiffEvolution {
   bool iterate();
 
  private:
-  Lambda<Scalar(ScalarField)> m_fitness;
+  Fitness m_fitness;
   VectorT<Vector2X<Scalar>> m_bounds;
   size_t m_dim;
-  Lambda<Scalar(ScalarField)> m_constraints;
+  Constraints m_constraints;
   size_t m_maxiter;
   size_t m_breakafter;
   size_t m_popsize;
@@ -97,11 +111,11 @@ class DiffEvolution {
  * @param mutation Range for the mutation factor. Default is [0.5, 0.8].
  * @param recombination Recombination probability. Default is 0.8.
  */
-template<typename Scalar, typename ScalarField>
-DiffEvolution<Scalar, ScalarField>::DiffEvolution(
-	Lambda<Scalar(ScalarField)> fitness,
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::DiffEvolution(
+	Fitness fitness,
 	VectorT<Vector2X<Scalar>> bounds,
-	Lambda<Scalar(ScalarField)> constraints,
+	Constraints constraints,
 	const size_t maxiter,
 	const size_t breakafter,
 	const size_t popsize,
@@ -137,8 +151,8 @@ DiffEvolution<Scalar, ScalarField>::DiffEvolution(
  *
  * @return Scalar field that minimizes the objective function.
  */
-template<typename Scalar, typename ScalarField>
-ScalarField DiffEvolution<Scalar, ScalarField>::optimize() {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+ScalarField DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::optimize() {
   generate();
 
   size_t last_best = 0;
@@ -165,8 +179,8 @@ ScalarField DiffEvolution<Scalar, ScalarField>::optimize() {
  *
  * @param candidate Candidate solution to be checked and adjusted.
  */
-template<typename Scalar, typename ScalarField>
-void DiffEvolution<Scalar, ScalarField>::ensureBounds(ScalarField& candidate) {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+void DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::ensureBounds(ScalarField& candidate) {
   // TODO: Select method
   // TODO: Vectorize
   for (size_t i = 0; i < m_dim; i++) {
@@ -199,8 +213,8 @@ void DiffEvolution<Scalar, ScalarField>::ensureBounds(ScalarField& candidate) {
  *
  * @return Array of 'n' unique random indexes.
  */
-template<typename Scalar, typename ScalarField>
-VectorX<size_t> DiffEvolution<Scalar, ScalarField>::generateSamples(
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+VectorX<size_t> DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::generateSamples(
 	const Index n,
 	const size_t candidate_index) {
   VectorX<size_t> indexes(n);
@@ -226,19 +240,42 @@ VectorX<size_t> DiffEvolution<Scalar, ScalarField>::generateSamples(
 /**
  * @brief Initialize the population and evaluate constraints and fitness.
  *
- * Initializes the population of candidate solutions by randomly generating
- * values within the specified bounds for each dimension. It then evaluates the
+ * Initializes the population of candidate solutions with a randomized Sobol
+ * sequence scaled to the specified bounds for each dimension, falling back to
+ * uniform random values above 21 dimensions. It then evaluates the
  * constraints and fitness values for each candidate solution. The method takes
  * into account only the candidate solutions that are feasible (satisfy
  * constraints) when computing fitness values.
  */
-template<typename Scalar, typename ScalarField>
-void DiffEvolution<Scalar, ScalarField>::generate() {
-  // TODO: Change generation method to Halton
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+void DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::generate() {
   // TODO: Parallelize
+  const Index dim = static_cast<Index>(m_dim);
+  const bool quasi = dim <= internal::ConstsSobol::kMaxDim;
+
+  // Sobol points from a random offset and rotated by a random shift modulo 1,
+  // so that each run starts from a different, but evenly spread, population
+  MatrixSQX<Scalar> unit;
+  if (quasi) {
+	uniform_int_distribution<Index> rand_offset(0, Index {1} << 20);
+	uniform_real_distribution<Scalar> rand_shift(0.0, 1.0);
+
+	SobolSequence<Scalar> sobol(dim, rand_offset(m_gen));
+	unit = sobol.generate(static_cast<Index>(m_popsize));
+
+	for (Index j = 0; j < dim; j++) {
+	  Scalar shift = rand_shift(m_gen);
+	  unit.row(j) = (unit.row(j).array() + shift).unaryExpr([](Scalar u) -> Scalar {
+		return u < Scalar(1) ? u : u - Scalar(1);
+	  });
+	}
+  }
+
   for (size_t i = 0; i < m_popsize; i++) {
 	for (size_t j = 0; j < m_dim; j++) {
-	  m_population[i][j] = m_rand_bounds[j](m_gen);
+	  m_population[i][j] = quasi
+		  ? m_bounds[j][0] + unit(j, i) * (m_bounds[j][1] - m_bounds[j][0])
+		  : m_rand_bounds[j](m_gen);
 	}
 
 	m_population[i].constraint = m_constraints(m_population[i].value);
@@ -264,9 +301,10 @@ void DiffEvolution<Scalar, ScalarField>::generate() {
  * @param samples Array of indexes specifying the three candidate solutions to
  *  be used in the mutation.
  */
-template<typename Scalar, typename ScalarField>
-void DiffEvolution<Scalar, ScalarField>::mutateRand1(ScalarField& candidate,
-													 const VectorX<size_t>& samples) {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+void DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::mutateRand1(
+	ScalarField& candidate,
+	const VectorX<size_t>& samples) {
   candidate = m_population[samples[2]].value
 	  + m_mutation * (m_population[samples[0]].value
 		  - m_population[samples[1]].value);
@@ -284,9 +322,10 @@ void DiffEvolution<Scalar, ScalarField>::mutateRand1(ScalarField& candidate,
  * @param samples A vector of indexes specifying the three candidate solutions
  *  to be used in the mutation.
  */
-template<typename Scalar, typename ScalarField>
-void DiffEvolution<Scalar, ScalarField>::mutateBest1(ScalarField& candidate,
-													 const VectorX<size_t>& samples) {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+void DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::mutateBest1(
+	ScalarField& candidate,
+	const VectorX<size_t>& samples) {
   candidate = m_population.best_individual.value
 	  + m_mutation * (m_population[samples[0]].value
 		  - m_population[samples[1]].value);
@@ -307,8 +346,8 @@ void DiffEvolution<Scalar, ScalarField>::mutateBest1(ScalarField& candidate,
  *
  * @return Trial candidate solution generated through crossover and mutation.
  */
-template<typename Scalar, typename ScalarField>
-ScalarField DiffEvolution<Scalar, ScalarField>::crossover(size_t pos) {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+ScalarField DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::crossover(size_t pos) {
   ScalarField trial = m_population[pos].value;
 
   if (m_population[pos].constraint <= 0.0) {
@@ -343,8 +382,8 @@ ScalarField DiffEvolution<Scalar, ScalarField>::crossover(size_t pos) {
  * @return True if a better solution is found during the iteration,
  *  false otherwise.
  */
-template<typename Scalar, typename ScalarField>
-bool DiffEvolution<Scalar, ScalarField>::iterate() {
+template<typename Scalar, typename ScalarField, typename Fitness, typename Constraints>
+bool DiffEvolution<Scalar, ScalarField, Fitness, Constraints>::iterate() {
   bool found_better = false;
 
   m_mutation = m_rand_mutation(m_gen);
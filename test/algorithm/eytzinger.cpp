@@ -0,0 +1,60 @@
+#include "nuenv/src/algorithm/eytzinger.hpp"
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+TEST(EytzingerTest, SmallArrayInt) {
+  const VectorX<int> arr = VectorX_s<int, 10> {-5, -4, -3, -2, -1, 0, 2, 3, 4, 5};
+  const EytzingerIndex<int> index(arr);
+
+  EXPECT_EQ(SearchSorted(index, -6), 0);
+  EXPECT_EQ(SearchSorted(index, -5), 0);
+  EXPECT_EQ(SearchSorted(index, 0), 5);
+  EXPECT_EQ(SearchSorted(index, 1), 5);
+  EXPECT_EQ(SearchSorted(index, 5), 9);
+  EXPECT_EQ(SearchSorted(index, 6), 9);
+}
+
+TEST(EytzingerTest, SingleElement) {
+  const VectorX<double> arr = VectorX<double>::Constant(1, 1.0);
+  const EytzingerIndex<double> index(arr);
+
+  EXPECT_EQ(index.search(0.0), 0);
+  EXPECT_EQ(index.search(1.0), 0);
+  EXPECT_EQ(index.search(2.0), 0);
+}
+
+TEST(EytzingerTest, MatchesBinarySearch) {
+  for (Index size = 1; size < 300; size += 7) {
+	const VectorX<double> arr = VectorX<double>::LinSpaced(size, 0.0, 1.0);
+	const EytzingerIndex<double> index(arr);
+
+	EXPECT_EQ(index.size(), size);
+
+	const VectorX<double> queries = VectorX<double>::LinSpaced(1001, -0.1, 1.1);
+	for (Index i = 0; i < queries.size(); i++) {
+	  EXPECT_EQ(index.search(queries[i]),
+				internal::binarySearch(arr, queries[i]));
+	}
+
+	for (Index i = 0; i < arr.size(); i++) {
+	  EXPECT_EQ(index.search(arr[i]), i);
+	}
+  }
+}
+
+TEST(EytzingerTest, Duplicates) {
+  VectorX<int> arr(100);
+  for (Index i = 0; i < arr.size(); i++) { arr[i] = static_cast<int>(i / 3); }
+  const EytzingerIndex<int> index(arr);
+
+  for (int val = -1; val <= 35; val++) {
+	EXPECT_EQ(index.search(val), internal::binarySearch(arr, val));
+  }
+}
+
+} // namespace nuenv::test
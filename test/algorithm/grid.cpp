@@ -0,0 +1,145 @@
+#include "nuenv/src/algorithm/grid.hpp"
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/algorithm/space.hpp"
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+template<typename Grid>
+void expectMatchesBinarySearch(const Grid& grid, double a, double b) {
+  const VectorX<double> arr = grid.toVector();
+  const VectorX<double> queries = VectorX<double>::LinSpaced(4001, a, b);
+
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(SearchSorted(grid, queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+
+  for (Index i = 0; i < arr.size(); i++) {
+	EXPECT_EQ(grid.search(arr[i]), i);
+  }
+}
+
+TEST(GridTest, UniformGrid) {
+  const UniformGrid<double> grid(-1.0, 3.0, 101);
+
+  EXPECT_EQ(grid.size(), 101);
+  EXPECT_DOUBLE_EQ(grid[0], -1.0);
+  EXPECT_DOUBLE_EQ(grid[100], 3.0);
+  ASSERT_TRUE(grid.toVector().isApprox(LinearSpace(-1.0, 3.0, 101)));
+
+  expectMatchesBinarySearch(grid, -1.5, 3.5);
+}
+
+TEST(GridTest, LogarithmicGrid) {
+  const LogarithmicGrid<double> grid(1e-3, 1e3, 97);
+
+  EXPECT_DOUBLE_EQ(grid[0], 1e-3);
+  EXPECT_DOUBLE_EQ(grid[96], 1e3);
+  ASSERT_TRUE(grid.toVector().isApprox(LogarithmicSpace(1e-3, 1e3, 97)));
+
+  expectMatchesBinarySearch(grid, -1.0, 1.1e3);
+}
+
+TEST(GridTest, GeometricGrid) {
+  const GeometricGrid<double> grid(1.0, 100.0, 5);
+
+  EXPECT_NEAR(grid[1], sqrt(10.0), 1e-8);
+  EXPECT_DOUBLE_EQ(grid[4], 100.0);
+  ASSERT_TRUE(grid.toVector().isApprox(geometricSpace(1.0, 100.0, 5)));
+
+  expectMatchesBinarySearch(grid, 0.0, 110.0);
+}
+
+TEST(GridTest, TwoPoints) {
+  // Smallest grids, whose spacing is set by the bounds alone
+  const UniformGrid<double> uniform(-1.0, 3.0, 2);
+  const LogarithmicGrid<double> log_grid(1e-3, 1e3, 2);
+  const GeometricGrid<double> geo_grid(1.0, 100.0, 2);
+
+  EXPECT_DOUBLE_EQ(uniform[1], 3.0);
+  EXPECT_DOUBLE_EQ(log_grid[1], 1e3);
+  EXPECT_DOUBLE_EQ(geo_grid[1], 100.0);
+
+  expectMatchesBinarySearch(uniform, -1.5, 3.5);
+  expectMatchesBinarySearch(log_grid, -1.0, 1.1e3);
+  expectMatchesBinarySearch(geo_grid, 0.0, 110.0);
+}
+
+TEST(GridTest, SearchNaN) {
+  const UniformGrid<double> grid(0.0, 1.0, 11);
+
+  EXPECT_EQ(grid.search(numeric_limits<double>::quiet_NaN()), 10);
+}
+
+TEST(GridTest, SearchNonPositiveLog) {
+  const LogarithmicGrid<double> log_grid(1e-3, 1e3, 97);
+  const GeometricGrid<double> geo_grid(1.0, 100.0, 5);
+  const VectorX<double> arr = LogarithmicSpace(1e-3, 1e3, 97);
+  const SortedIndex<double> index(arr);
+  constexpr double nan = numeric_limits<double>::quiet_NaN();
+
+  for (const double val : {-1e3, -1.0, -0.0, 0.0}) {
+	EXPECT_EQ(log_grid.search(val), 0);
+	EXPECT_EQ(geo_grid.search(val), 0);
+	EXPECT_EQ(index.search(val), 0);
+  }
+
+  EXPECT_EQ(log_grid.search(nan), 96);
+  EXPECT_EQ(geo_grid.search(nan), 4);
+  EXPECT_EQ(index.search(nan), 96);
+}
+
+TEST(GridTest, IsUniform) {
+  VectorX<double> arr = LinearSpace(0.0, 1.0, 1001);
+  EXPECT_TRUE(IsUniform(arr));
+  EXPECT_FALSE(IsLogUniform(arr));
+
+  // Within tolerance of the spacing
+  arr[500] += 1e-5 * 1e-3;
+  EXPECT_TRUE(IsUniform(arr));
+
+  arr[500] += 1e-2 * 1e-3;
+  EXPECT_FALSE(IsUniform(arr));
+
+  EXPECT_TRUE(IsLogUniform(LogarithmicSpace(1.0, 1e6, 1001)));
+  EXPECT_TRUE(IsLogUniform(geometricSpace(1.0, 1e6, 1001)));
+  EXPECT_FALSE(IsUniform(geometricSpace(1.0, 1e6, 1001)));
+}
+
+TEST(GridTest, SortedIndexNearUniform) {
+  // Evenly spaced within tolerance, searched arithmetically but still exact
+  VectorX<double> arr = LinearSpace(0.0, 1.0, 1001);
+  for (Index i = 1; i < arr.size() - 1; i += 3) { arr[i] += 0.5e-6; }
+  ASSERT_TRUE(IsUniform(arr));
+  const SortedIndex<double> index(arr);
+
+  for (Index i = 0; i < arr.size(); i++) {
+	EXPECT_EQ(index.search(arr[i]), i);
+	EXPECT_EQ(index.search(arr[i] - 1e-9), i - (i > 0));
+  }
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(7919, -0.1, 1.1);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(index.search(queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+}
+
+TEST(GridTest, SortedIndexIrregular) {
+  VectorX<double> arr = LinearSpace(0.0, 1.0, 1001);
+  arr = arr.array().pow(3.0);
+  const SortedIndex<double> index(arr);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(7919, -0.1, 1.1);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(index.search(queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+}
+
+} // namespace nuenv::test
@@ -0,0 +1,61 @@
+#include "nuenv/src/algorithm/hunt.hpp"
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+TEST(HuntTest, SmallArrayInt) {
+  const VectorX<int> arr = VectorX_s<int, 10> {-5, -4, -3, -2, -1, 0, 2, 3, 4, 5};
+  SearchCursor cursor;
+
+  EXPECT_EQ(SearchSorted(arr, 1, cursor), 5);
+  EXPECT_EQ(cursor.index(), 5);
+  EXPECT_EQ(SearchSorted(arr, 6, cursor), 9);
+  EXPECT_EQ(SearchSorted(arr, 5, cursor), 9);
+  EXPECT_EQ(SearchSorted(arr, -6, cursor), 0);
+  EXPECT_EQ(SearchSorted(arr, -5, cursor), 0);
+  EXPECT_EQ(SearchSorted(arr, 0, cursor), 5);
+  EXPECT_EQ(SearchSorted(arr, -4, cursor), 1);
+}
+
+TEST(HuntTest, MonotoneSweep) {
+  const VectorX<double> arr = VectorX<double>::LinSpaced(1000, 0.0, 1.0).array().square();
+  SearchCursor cursor;
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(5003, -0.1, 1.1);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(cursor.search(arr, queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+
+  for (Index i = queries.size() - 1; i >= 0; i--) {
+	EXPECT_EQ(cursor.search(arr, queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+}
+
+TEST(HuntTest, RandomJumps) {
+  const VectorX<double> arr = VectorX<double>::LinSpaced(777, 0.0, 1.0).array().sqrt();
+  const VectorX<double> queries = 0.6 * VectorX<double>::Random(5003).array() + 0.5;
+  SearchCursor cursor(10000);
+
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(cursor.search(arr, queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+}
+
+TEST(HuntTest, Duplicates) {
+  VectorX<int> arr(100);
+  for (Index i = 0; i < arr.size(); i++) { arr[i] = static_cast<int>(i / 3); }
+  SearchCursor cursor;
+
+  for (int val = 35; val >= -1; val--) {
+	EXPECT_EQ(cursor.search(arr, val), internal::binarySearch(arr, val));
+  }
+}
+
+} // namespace nuenv::test
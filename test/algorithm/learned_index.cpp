@@ -0,0 +1,77 @@
+#include "nuenv/src/algorithm/learned_index.hpp"
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/sorted_index.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/random.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+VectorX<double> randomSorted(Index size) {
+  minstd_rand gen(7);
+  uniform_real_distribution<double> dist(0.0, 1.0);
+
+  VectorX<double> arr(size);
+  for (auto& a : arr) { a = dist(gen); }
+  std::sort(arr.begin(), arr.end());
+
+  return arr;
+}
+
+TEST(LearnedIndexTest, SmallArrayInt) {
+  const VectorX<int> arr = VectorX_s<int, 10> {-5, -4, -3, -2, -1, 0, 2, 3, 4, 5};
+  const LearnedIndex<int, 1> index(arr);
+
+  EXPECT_EQ(SearchSorted(index, -6), 0);
+  EXPECT_EQ(SearchSorted(index, -5), 0);
+  EXPECT_EQ(SearchSorted(index, 1), 5);
+  EXPECT_EQ(SearchSorted(index, 5), 9);
+  EXPECT_EQ(SearchSorted(index, 6), 9);
+}
+
+TEST(LearnedIndexTest, NearUniformMatchesBinarySearch) {
+  const VectorX<double> arr = randomSorted(20000);
+  const LearnedIndex<double> index(arr);
+
+  // Near-uniform keys need far fewer segments than keys
+  EXPECT_LT(index.segments(), arr.size() / 64);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(30011, -0.1, 1.1);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(index.search(queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+
+  for (Index i = 0; i < arr.size(); i++) {
+	EXPECT_EQ(index.search(arr[i]), internal::binarySearch(arr, arr[i]));
+  }
+}
+
+TEST(LearnedIndexTest, SkewedDuplicates) {
+  VectorX<int> arr(5000);
+  for (Index i = 0; i < arr.size(); i++) {
+	arr[i] = static_cast<int>((i / 40) * (i / 40));
+  }
+  const LearnedIndex<int, 4> index(arr);
+
+  for (int val = -1; val <= arr[arr.size() - 1] + 1; val += 3) {
+	EXPECT_EQ(index.search(val), internal::binarySearch(arr, val));
+  }
+}
+
+TEST(LearnedIndexTest, SortedIndexSelection) {
+  // Whichever method the index picks, the results are those of a binary search
+  const VectorX<double> arr = randomSorted(10000);
+  const SortedIndex<double> index(arr);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(10007, -0.1, 1.1);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(index.search(queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+}
+
+} // namespace nuenv::test
@@ -0,0 +1,138 @@
+#include "nuenv/src/algorithm/low_discrepancy.hpp"
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/random.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace nuenv::test {
+
+// Every one of 'num' equal strata of each dimension holds exactly one point
+void expectStratified(const MatrixSQX<double>& points) {
+  const Index num = points.cols();
+
+  for (Index d = 0; d < points.rows(); d++) {
+	VectorX<Index> count = VectorX<Index>::Zero(num);
+	for (Index j = 0; j < num; j++) {
+	  ASSERT_GE(points(d, j), 0.0);
+	  ASSERT_LT(points(d, j), 1.0);
+	  count[static_cast<Index>(points(d, j) * static_cast<double>(num))]++;
+	}
+
+	EXPECT_EQ(count, VectorX<Index>::Ones(num)) << "dimension " << d;
+  }
+}
+
+TEST(LowDiscrepancyTest, HaltonValues) {
+  HaltonSequence<double> halton(2);
+  const MatrixSQX<double> points = halton.generate(5);
+
+  const double base2[] = {0.0, 1.0 / 2.0, 1.0 / 4.0, 3.0 / 4.0, 1.0 / 8.0};
+  const double base3[] = {0.0, 1.0 / 3.0, 2.0 / 3.0, 1.0 / 9.0, 4.0 / 9.0};
+
+  for (Index j = 0; j < 5; j++) {
+	EXPECT_DOUBLE_EQ(points(0, j), base2[j]);
+	EXPECT_DOUBLE_EQ(points(1, j), base3[j]);
+  }
+
+  EXPECT_EQ(halton.position(), 5);
+}
+
+TEST(LowDiscrepancyTest, HaltonStratified) {
+  // The first 'base^k' points of the dimension of that base lie on the
+  // distinct nodes 'j / base^k', one at the left edge of each stratum
+  HaltonSequence<double> halton(3);
+  const MatrixSQX<double> points = halton.generate(125);
+
+  const Index nums[] = {64, 81, 125};
+  for (Index d = 0; d < 3; d++) {
+	const Index num = nums[d];
+
+	VectorX<Index> count = VectorX<Index>::Zero(num);
+	for (Index j = 0; j < num; j++) {
+	  double node = points(d, j) * static_cast<double>(num);
+	  EXPECT_NEAR(node, std::round(node), 1e-9);
+	  count[static_cast<Index>(std::round(node))]++;
+	}
+
+	EXPECT_EQ(count, VectorX<Index>::Ones(num)) << "dimension " << d;
+  }
+}
+
+TEST(LowDiscrepancyTest, HaltonSkip) {
+  HaltonSequence<double> full(32);
+  const MatrixSQX<double> expected = full.generate(100);
+
+  HaltonSequence<double> offset(32, 37);
+  EXPECT_EQ(offset.generate(63), expected.rightCols(63));
+
+  HaltonSequence<double> skipped(32);
+  skipped.skip(60);
+  EXPECT_EQ(skipped.generate(40), expected.rightCols(40));
+}
+
+TEST(LowDiscrepancyTest, SobolValues) {
+  SobolSequence<double> sobol(3);
+  const MatrixSQX<double> points = sobol.generate(4);
+
+  MatrixSQX<double> expected(3, 4);
+  expected << 0.0, 0.5, 0.75, 0.25,
+	  0.0, 0.5, 0.25, 0.75,
+	  0.0, 0.5, 0.25, 0.75;
+
+  EXPECT_EQ(points, expected);
+  EXPECT_EQ(sobol.position(), 4);
+}
+
+TEST(LowDiscrepancyTest, SobolStratified) {
+  // Each dimension is a (0, 1)-sequence in base 2
+  SobolSequence<double> sobol(21);
+
+  expectStratified(sobol.generate(1024));
+  expectStratified(sobol.generate(1024));
+}
+
+TEST(LowDiscrepancyTest, SobolNet) {
+  // The first two dimensions form a (0, 2)-sequence: every elementary interval
+  // of volume 1/64 holds exactly one of the first 64 points
+  SobolSequence<double> sobol(2);
+  const MatrixSQX<double> points = sobol.generate(64);
+
+  for (Index a = 0; a <= 6; a++) {
+	const Index nx = Index {1} << a;
+	const Index ny = Index {1} << (6 - a);
+
+	MatrixSQX<Index> count = MatrixSQX<Index>::Zero(nx, ny);
+	for (Index j = 0; j < 64; j++) {
+	  count(static_cast<Index>(points(0, j) * static_cast<double>(nx)),
+			static_cast<Index>(points(1, j) * static_cast<double>(ny)))++;
+	}
+
+	EXPECT_EQ(count, MatrixSQX<Index>::Ones(nx, ny)) << "intervals " << nx << "x" << ny;
+  }
+}
+
+TEST(LowDiscrepancyTest, SobolSkip) {
+  SobolSequence<double> full(21);
+  const MatrixSQX<double> expected = full.generate(1000);
+
+  SobolSequence<double> offset(21, 377);
+  EXPECT_EQ(offset.generate(623), expected.rightCols(623));
+
+  SobolSequence<double> skipped(21);
+  skipped.generate(100);
+  skipped.skip(411);
+  EXPECT_EQ(skipped.generate(489), expected.rightCols(489));
+}
+
+TEST(LowDiscrepancyTest, LatinHypercube) {
+  minstd_rand gen(42);
+
+  for (Index num : {1, 2, 17, 500}) {
+	expectStratified(LatinHypercube<double>(6, num, gen));
+  }
+}
+
+}
@@ -1,9 +1,12 @@
 #include "nuenv/src/algorithm/search.hpp"
 
+#include "nuenv/src/algorithm/space.hpp"
 #include "nuenv/src/core/container.hpp"
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 // TODO: Test the performance with extremely large arrays
 // TODO: Test with duplicates
 
@@ -98,6 +101,81 @@ TEST(SearchTest, SearchSortedElementNotInArrayMiddleFloat) {
   EXPECT_EQ(result, expected);
 }
 
+TEST(SearchTest, SearchSortedBatchSortedQueries) {
+  const VectorX<double> arr = VectorX<double>::LinSpaced(1000, 0.0, 1.0);
+  const VectorX<double> queries = VectorX<double>::LinSpaced(3001, -0.1, 1.1);
+
+  VectorX<Index> result;
+  SearchSorted(arr, queries, result);
+
+  ASSERT_EQ(result.size(), queries.size());
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(result[i], internal::binarySearch(arr, queries[i]));
+  }
+}
+
+TEST(SearchTest, SearchSortedBatchSortedNaN) {
+  // NaN compares false both ways, so the rest of the batch still looks sorted
+  const VectorX<double> arr = VectorX<double>::LinSpaced(200, 0.0, 1.0);
+  const VectorX<double> queries = VectorX<double>::LinSpaced(300, -0.1, 1.1);
+
+  for (const Index nan : {0, 150, 299}) {
+	VectorX<double> batch = queries;
+	batch[nan] = numeric_limits<double>::quiet_NaN();
+	if (nan == 150) { batch[151] = 0.0; }
+
+	VectorX<Index> result;
+	SearchSorted(arr, batch, result);
+
+	ASSERT_EQ(result.size(), batch.size());
+	for (Index i = 0; i < batch.size(); i++) {
+	  EXPECT_EQ(result[i], internal::binarySearch(arr, batch[i]));
+	}
+  }
+}
+
+TEST(SearchTest, SearchSortedBatchUnsortedQueries) {
+  const VectorX<double> arr = VectorX<double>::LinSpaced(1000, 0.0, 1.0);
+  const VectorX<double> queries = 0.6 * VectorX<double>::Random(3001);
+
+  VectorX<Index> result;
+  SearchSorted(arr, queries, result);
+
+  ASSERT_EQ(result.size(), queries.size());
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(result[i], internal::binarySearch(arr, queries[i]));
+  }
+}
+
+TEST(SearchTest, SearchSortedBatchView) {
+  const VectorX<double> arr = VectorX<double>::LinSpaced(1000, 0.0, 1.0).array().square();
+  const auto queries = LinearSpaceView(-0.1, 1.1, 3001);
+
+  VectorX<Index> result;
+  SearchSorted(arr, queries, result);
+
+  ASSERT_EQ(result.size(), 3001);
+  for (Index i = 0; i < result.size(); i++) {
+	EXPECT_EQ(result[i], internal::binarySearch(arr, queries[i]));
+  }
+
+  SearchSorted(arr, queries | std::views::reverse, result);
+  for (Index i = 0; i < result.size(); i++) {
+	EXPECT_EQ(result[i], internal::binarySearch(arr, queries[3000 - i]));
+  }
+}
+
+TEST(SearchTest, SearchSortedBatchInt) {
+  const VectorX<int> arr = kVectorIntSorted;
+  const VectorX<int> queries = VectorX_s<int, 9> {6, -6, 1, 0, -5, 5, 2, 1, -1};
+
+  VectorX<Index> result;
+  SearchSorted(arr, queries, result);
+  const VectorX_s<Index, 9> expected = {9, 0, 5, 5, 0, 9, 6, 5, 4};
+
+  EXPECT_EQ(result, expected);
+}
+
 VectorX_s<int, 10> kVectorIntUnsorted = {3, 0, -3, 5, -4, -1, 2, -5, 4, -2};
 
 TEST(SearchTest, SearchUnsortedFoundElementInt) {
@@ -128,5 +206,87 @@ TEST(SearchTest, SearchUnsortedElementNotInArrayInt) {
   EXPECT_EQ(result, expected);
 }
 
+template<typename Scalar>
+void expectUnsortedMatchesLinear(Index size) {
+  VectorX<Scalar> arr(size);
+  for (Index i = 0; i < size; i++) {
+	arr[i] = static_cast<Scalar>((i * 7919) % size);
+  }
+
+  for (Index val = -1; val <= size; val++) {
+	EXPECT_EQ(SearchUnsorted(arr, static_cast<Scalar>(val)),
+			  internal::linearSearch(arr, static_cast<Scalar>(val)));
+  }
+}
+
+TEST(SearchTest, SearchUnsortedLargeArray) {
+  for (Index size : {1, 3, 17, 64, 100, 1031}) {
+	expectUnsortedMatchesLinear<int>(size);
+	expectUnsortedMatchesLinear<int64_t>(size);
+	expectUnsortedMatchesLinear<float>(size);
+	expectUnsortedMatchesLinear<double>(size);
+  }
+}
+
+TEST(SearchTest, SearchUnsortedFloatSpecialValues) {
+  const VectorX<double> arr = VectorX_s<double, 5> {
+	  1.0, numeric_limits<double>::quiet_NaN(), -0.0, 2.0, 0.0};
+
+  EXPECT_EQ(SearchUnsorted(arr, 0.0), 2);
+  EXPECT_EQ(SearchUnsorted(arr, numeric_limits<double>::quiet_NaN()), 5);
+}
+
+TEST(SearchTest, SearchUnsortedBatch) {
+  VectorX<double> arr(5000);
+  for (Index i = 0; i < arr.size(); i++) {
+	arr[i] = static_cast<double>((i * 7919) % 4000);
+  }
+
+  for (Index num : {5, 100}) {
+	VectorX<double> keys = VectorX<double>::LinSpaced(num, -10.0, 4010.0).array().round();
+	keys[0] = numeric_limits<double>::quiet_NaN();
+	keys[1] = keys[num - 1];
+
+	VectorX<Index> result;
+	SearchUnsorted(arr, keys, result);
+
+	ASSERT_EQ(result.size(), num);
+	for (Index j = 0; j < num; j++) {
+	  EXPECT_EQ(result[j], SearchUnsorted(arr, keys[j]));
+	}
+  }
+}
+
+TEST(SearchTest, SearchViews) {
+  const std::vector<double> buffer = {-2.0, -1.0, 0.5, 1.0, 3.0, 7.0};
+  const VectorX<double> arr = AsVector(buffer);
+
+  MatrixSQX<double> table(buffer.size(), 2);
+  table.col(0) = arr;
+  table.col(1) = -arr;
+
+  const VectorX<double> queries = LinearSpace(-3.0, 8.0, 50);
+  for (double val : queries) {
+	Index expected = SearchSorted(arr, val);
+
+	EXPECT_EQ(SearchSorted(AsVector(buffer), val), expected);
+	EXPECT_EQ(SearchSorted(table.col(0), val), expected);
+	EXPECT_EQ(SearchSorted(AsVector(table.col(0)), val), expected);
+	EXPECT_EQ(SearchUnsorted(table.col(1), -val), SearchUnsorted(arr, val));
+  }
+
+  VectorX<Index> expected, out;
+  SearchSorted(arr, queries, expected);
+  SearchSorted(AsVector(buffer), queries, out);
+  EXPECT_EQ(out, expected);
+
+  SearchUnsorted(arr, queries, expected);
+  SearchUnsorted(AsVector(buffer), queries, out);
+  EXPECT_EQ(out, expected);
+
+  // The view references the buffer
+  EXPECT_EQ(AsVector(buffer).data(), buffer.data());
+  EXPECT_EQ(AsVector(table.col(1)).data(), table.col(1).data());
+}
 
 } // namespace nuenv::test
@@ -0,0 +1,110 @@
+#include "nuenv/src/algorithm/sorted_index.hpp"
+
+#include "nuenv/src/algorithm/search.hpp"
+#include "nuenv/src/algorithm/space.hpp"
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace nuenv::test {
+
+TEST(SortedIndexTest, SmallArrayInt) {
+  const VectorX<int> arr = VectorX_s<int, 10> {-5, -4, -3, -2, -1, 0, 2, 3, 4, 5};
+  const SortedIndex<int> index(arr);
+
+  EXPECT_EQ(SearchSorted(index, -6), 0);
+  EXPECT_EQ(SearchSorted(index, -5), 0);
+  EXPECT_EQ(SearchSorted(index, 1), 5);
+  EXPECT_EQ(SearchSorted(index, 5), 9);
+  EXPECT_EQ(SearchSorted(index, 6), 9);
+}
+
+TEST(SortedIndexTest, LargeArrayMatchesBinarySearch) {
+  const VectorX<double> arr = geometricSpace(1.0, 1e4, 1001);
+  const SortedIndex<double> index(arr);
+
+  EXPECT_EQ(index.size(), arr.size());
+
+  const VectorX<double> queries = LinearSpace(0.5, 1.1e4, 5003);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(index.search(queries[i]),
+			  internal::binarySearch(arr, queries[i]));
+  }
+
+  // Exact nodes
+  for (Index i = 0; i < arr.size(); i++) {
+	EXPECT_EQ(index.search(arr[i]), i);
+  }
+}
+
+TEST(SortedIndexTest, LargeArrayDuplicates) {
+  VectorX<int> arr(200);
+  for (Index i = 0; i < arr.size(); i++) { arr[i] = static_cast<int>(i / 4); }
+  const SortedIndex<int> index(arr);
+
+  for (int val = -1; val <= 51; val++) {
+	EXPECT_EQ(index.search(val), internal::binarySearch(arr, val));
+  }
+}
+
+TEST(SortedIndexTest, BatchMatchesSearch) {
+  const VectorX<double> skewed = LinearSpace(0.0, 1.0, 1001).array().cube();
+  const VectorX<double> uniform = LinearSpace(0.0, 1.0, 1001);
+
+  const VectorX<double> sorted = LinearSpace(-0.1, 1.1, 4000);
+  const VectorX<double> unsorted = sorted.reverse();
+
+  for (const VectorX<double>* arr : {&skewed, &uniform}) {
+	const SortedIndex<double> index(*arr);
+
+	for (const VectorX<double>* queries : {&sorted, &unsorted}) {
+	  VectorX<Index> out;
+	  SearchSorted(index, *queries, out);
+
+	  ASSERT_EQ(out.size(), queries->size());
+	  for (Index i = 0; i < queries->size(); i++) {
+		EXPECT_EQ(out[i], index.search((*queries)[i]));
+	  }
+	}
+  }
+}
+
+TEST(SortedIndexTest, BatchSortedNaN) {
+  const VectorX<double> arr = LinearSpace(0.0, 1.0, 200).array().cube();
+  const SortedIndex<double> index(arr);
+
+  VectorX<double> queries = LinearSpace(-0.1, 1.1, 300);
+  queries[0] = numeric_limits<double>::quiet_NaN();
+
+  VectorX<Index> out;
+  SearchSorted(index, queries, out);
+
+  ASSERT_EQ(out.size(), queries.size());
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_EQ(out[i], index.search(queries[i]));
+  }
+}
+
+TEST(SortedIndexTest, View) {
+  std::vector<double> buffer(5000);
+  for (size_t i = 0; i < buffer.size(); i++) { buffer[i] = static_cast<double>(i * i) / 1e3; }
+
+  const VectorX<double> arr = AsVector(buffer);
+  const SortedIndex<double> owned(arr);
+  const SortedIndex<double> view(AsVector(buffer));
+
+  EXPECT_EQ(view.data().data(), buffer.data());
+  EXPECT_EQ(view.size(), arr.size());
+
+  const VectorX<double> queries = LinearSpace(-1.0, 3e4, 3001);
+  for (double val : queries) { EXPECT_EQ(view.search(val), owned.search(val)); }
+
+  VectorX<Index> expected, out;
+  SearchSorted(owned, queries, expected);
+  SearchSorted(view, queries, out);
+  EXPECT_EQ(out, expected);
+}
+
+} // namespace nuenv::test
@@ -4,6 +4,8 @@
 
 #include "gtest/gtest.h"
 
+#include <ranges>
+
 namespace nuenv::test {
 
 TEST(SpaceTest, LinearSpaceTest) {
@@ -27,6 +29,9 @@ TEST(SpaceTest, GeometricSpaceTest) {
 
   // Check for zero number of elements
   EXPECT_EQ(geometricSpace(1.0, 5.0, 0).size(), 0);
+
+  // Check for a single element
+  EXPECT_DOUBLE_EQ(geometricSpace(2.0, 5.0, 1)[0], 2.0);
 }
 
 TEST(SpaceTest, LogarithmicSpaceTest) {
@@ -39,4 +44,75 @@ TEST(SpaceTest, LogarithmicSpaceTest) {
   EXPECT_EQ(LogarithmicSpace(1.0, 5.0, 0).size(), 0);
 }
 
+TEST(SpaceTest, FixedSizeSpaceTest) {
+  const VectorX_s<double, 5> linear = LinearSpace<5>(1.0, 5.0);
+  const VectorX_s<double, 5> logarithmic = LogarithmicSpace<5>(1.0, 100.0);
+  const VectorX_s<float, 5> geometric = geometricSpace<5>(1.0f, 100.0f);
+
+  ASSERT_TRUE(linear.isApprox(LinearSpace(1.0, 5.0, 5)));
+  ASSERT_TRUE(logarithmic.isApprox(LogarithmicSpace(1.0, 100.0, 5)));
+  ASSERT_TRUE(geometric.isApprox(geometricSpace(1.0f, 100.0f, 5)));
+}
+
+template<typename Scalar>
+void expectExp2Ulp(Scalar lo, Scalar hi) {
+  VectorX<Scalar> arr = VectorX<Scalar>::LinSpaced(100003, lo, hi);
+  const VectorX<Scalar> exponents = arr;
+  internal::exp2InPlace(arr);
+
+  for (Index i = 0; i < arr.size(); i++) {
+	const Scalar expected = exp2(exponents[i]);
+	const Scalar ulp = std::nextafter(expected, numeric_limits<Scalar>::infinity()) - expected;
+	ASSERT_LE(abs(arr[i] - expected), 2 * ulp) << "exponent " << exponents[i];
+  }
+}
+
+TEST(SpaceTest, Exp2UlpBound) {
+  expectExp2Ulp<double>(-1000.0, 1000.0);
+  expectExp2Ulp<float>(-120.0f, 120.0f);
+}
+
+TEST(SpaceTest, LinearSpaceViewTest) {
+  const VectorX<double> expVector = LinearSpace(-1.0, 5.0, 7);
+  const auto view = LinearSpaceView(-1.0, 5.0, 7);
+
+  static_assert(std::ranges::random_access_range<decltype(view)>);
+  static_assert(std::ranges::sized_range<decltype(view)>);
+
+  ASSERT_EQ(std::ranges::ssize(view), expVector.size());
+  for (Index i = 0; i < expVector.size(); i++) {
+	EXPECT_NEAR(view[i], expVector[i], 1e-12);
+  }
+
+  // Composes with the standard views
+  auto reversed = view | std::views::reverse | std::views::take(2);
+  EXPECT_DOUBLE_EQ(*reversed.begin(), 5.0);
+
+  EXPECT_EQ(std::ranges::size(LinearSpaceView(1.0, 5.0, 0)), 0u);
+}
+
+TEST(SpaceTest, GeometricSpaceViewTest) {
+  const VectorX<double> expVector = geometricSpace(1.0, 100.0, 5);
+  const auto view = geometricSpaceView(1.0, 100.0, 5);
+
+  ASSERT_EQ(std::ranges::ssize(view), expVector.size());
+  for (Index i = 0; i < expVector.size(); i++) {
+	EXPECT_NEAR(view[i], expVector[i], 1e-8);
+  }
+
+  EXPECT_EQ(std::ranges::size(geometricSpaceView(1.0, 5.0, 0)), 0u);
+}
+
+TEST(SpaceTest, LogarithmicSpaceViewTest) {
+  const VectorX<double> expVector = LogarithmicSpace(1e-3, 1e3, 13);
+  const auto view = LogarithmicSpaceView(1e-3, 1e3, 13);
+
+  ASSERT_EQ(std::ranges::ssize(view), expVector.size());
+  for (Index i = 0; i < expVector.size(); i++) {
+	EXPECT_NEAR(view[i], expVector[i], 1e-12 * expVector[i]);
+  }
+
+  EXPECT_EQ(std::ranges::size(LogarithmicSpaceView(1.0, 5.0, 0)), 0u);
+}
+
 } // namespace nuenv::test
@@ -0,0 +1,54 @@
+#include "nuenv/src/core/thread_pool.hpp"
+
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+namespace nuenv::test {
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+
+  VectorT<Index> out(1000, 0);
+  ThreadPool::Group group;
+  for (Index i = 0; i < 1000; i++) {
+	pool.submit(group, [&out, i]() { out[i] = i * i; });
+  }
+  pool.wait(group);
+
+  for (Index i = 0; i < 1000; i++) { EXPECT_EQ(out[i], i * i); }
+}
+
+TEST(ThreadPoolTest, NestedTasks) {
+  ThreadPool pool(3);
+  std::atomic<Index> leaves {0};
+
+  // Binary tree of tasks, each waiting on its children
+  Lambda<void(Index)> spawn = [&](const Index depth) {
+	if (depth == 0) {
+	  leaves++;
+	  return;
+	}
+
+	ThreadPool::Group group;
+	pool.submit(group, [&, depth]() { spawn(depth - 1); });
+	pool.submit(group, [&, depth]() { spawn(depth - 1); });
+	pool.wait(group);
+  };
+
+  ThreadPool::Group group;
+  pool.submit(group, [&]() { spawn(10); });
+  pool.wait(group);
+
+  EXPECT_EQ(leaves, 1024);
+}
+
+TEST(ThreadPoolTest, DefaultSize) {
+  ThreadPool pool;
+  EXPECT_GE(pool.size(), 1);
+}
+
+} // namespace nuenv::test
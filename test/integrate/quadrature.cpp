@@ -1,11 +1,17 @@
 #include "nuenv/src/integrate/quadrature.hpp"
 
+#include "nuenv/src/core/lambda.hpp"
 #include "nuenv/src/core/math.hpp"
+#include "nuenv/src/core/thread_pool.hpp"
 
 #include <gtest/gtest.h>
 
 namespace nuenv::test {
 
+double cube(const double x) {
+  return x * x * x;
+}
+
 TEST(QuadratureTest, QuadratureATest) {
   // Define a lambda function for the test
   const Lambda<double(double)> func = [](const double x) {
@@ -22,6 +28,297 @@ TEST(QuadratureTest, QuadratureATest) {
   EXPECT_NEAR(result, expected_result, tol);
 }
 
+TEST(QuadratureTest, QuadratureASharesNodes) {
+  Index calls = 0;
+  const Lambda<double(double)> func = [&calls](const double x) {
+	calls++;
+	return x * x * x * x;
+  };
+
+  const double result = quadratureA(func, 0.0, 2.0, 1e-8);
+
+  // A single panel integrates the polynomial exactly
+  EXPECT_EQ(calls, 21);
+  EXPECT_NEAR(result, 32.0 / 5.0, 1e-12);
+}
+
+TEST(QuadratureTest, QuadratureAParallel) {
+  const Lambda<double(double)> func = [](const double x) {
+	return -exp(-sqrt2 * x) - 0.05 * exp(0.5 * cos(20 * pi * x)) + 1 + e / 20;
+  };
+
+  constexpr double tol = 1e-12;
+  const double serial = quadratureA(func, 0.0, 1.0, tol);
+
+  // Same bits whatever the number of threads or the spawn cutoff
+  for (const Index threads : {1, 2, 4, 7}) {
+	ThreadPool pool(threads);
+	EXPECT_EQ(quadratureA(pool, func, 0.0, 1.0, tol), serial);
+	EXPECT_EQ(quadratureA(pool, func, 0.0, 1.0, tol, 1), serial);
+	EXPECT_EQ(quadratureA(pool, func, 0.0, 1.0, tol, 64), serial);
+  }
+}
+
+TEST(QuadratureTest, QuadratureCallable) {
+  const auto func = [](const double x) {
+	return -exp(-sqrt2 * x) - 0.05 * exp(0.5 * cos(20 * pi * x)) + 1 + e / 20;
+  };
+  const Lambda<double(double)> erased = func;
+  const FunctionRef<double(double)> ref = func;
+
+  constexpr double tol = 1e-10;
+  const double expected = quadratureA(erased, 0.0, 1.0, tol);
+
+  // Same arithmetic whatever the callable type
+  EXPECT_EQ(quadratureA(func, 0.0, 1.0, tol), expected);
+  EXPECT_EQ(quadratureA(ref, 0.0, 1.0, tol), expected);
+  EXPECT_EQ(quadratureAdaptive(func, 0.0, 1.0, tol).integral,
+			quadratureAdaptive(erased, 0.0, 1.0, tol).integral);
+  EXPECT_EQ(quadratureG3([](const double x) { return x * x; }, 0.0, 1.0),
+			quadratureG3(Lambda<double(double)>([](const double x) { return x * x; }), 0.0, 1.0));
+
+  // Function pointers
+  const double result = quadratureA<double>(static_cast<double (*)(double)>(exp), 0.0, 1.0, 1e-12);
+  EXPECT_NEAR(result, e - 1.0, 1e-12);
+
+  // Function pointers are held by value, so the temporary '&cube' is not
+  // referenced after the declaration
+  const FunctionRef<double(double)> pointer_ref = &cube;
+  const FunctionRef<double(double)> function_ref = cube;
+  EXPECT_EQ(pointer_ref(2.0), 8.0);
+  EXPECT_EQ(quadratureA(pointer_ref, 0.0, 1.0, tol), quadratureA(cube, 0.0, 1.0, tol));
+  EXPECT_EQ(quadratureA(function_ref, 0.0, 1.0, tol), quadratureA(cube, 0.0, 1.0, tol));
+}
+
+TEST(QuadratureTest, QuadratureAdaptive) {
+  const Lambda<double(double)> func = [](const double x) {
+	return -exp(-sqrt2 * x) - 0.05 * exp(0.5 * cos(20 * pi * x)) + 1 + e / 20;
+  };
+
+  constexpr double tol = 1e-12;
+
+  const auto result = quadratureAdaptive(func, 0.0, 1.0, tol);
+  constexpr double expected_result = 0.54754263323770047;
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_LE(result.error, tol);
+  EXPECT_NEAR(result.integral, expected_result, tol);
+  EXPECT_EQ(result.evaluations, 21 * (2 * result.intervals - 1));
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveVector) {
+  Index calls = 0;
+
+  // Moments of a Gaussian weight, sharing its evaluation
+  const auto func = [&calls](const double x) {
+	calls++;
+	const double w = exp(-x * x);
+	return VectorX_s<double, 4> {w, w * x, w * x * x, w * x * x * x};
+  };
+
+  constexpr double tol = 1e-12;
+  const auto result = quadratureAdaptive(func, -3.0, 3.0, tol);
+
+  const double erf3 = std::erf(3.0);
+  const double tail = exp(-9.0);
+  const VectorX_s<double, 4> expected {sqrt(pi) * erf3, 0.0, sqrt(pi) * erf3 / 2.0 - 3.0 * tail, 0.0};
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_LE(result.error, tol);
+  EXPECT_EQ(result.evaluations, calls);
+  for (Index i = 0; i < 4; i++) { EXPECT_NEAR(result.integral[i], expected[i], tol); }
+
+  // Each component on its own converges no later than the family
+  for (Index i = 0; i < 4; i++) {
+	const Lambda<double(double)> component = [&func, i](const double x) { return func(x)[i]; };
+	const auto single = quadratureAdaptive(component, -3.0, 3.0, tol);
+	EXPECT_LE(single.intervals, result.intervals);
+	EXPECT_NEAR(single.integral, result.integral[i], 2.0 * tol);
+  }
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveVectorDynamic) {
+  // Spectral bins of a peaked function, with as many components as bins
+  const VectorX<double> frequencies = VectorX<double>::LinSpaced(8, 1.0, 8.0);
+  const auto func = [&frequencies](const double x) {
+	return VectorX<double>((frequencies * x).array().cos() / (1.0 + x * x));
+  };
+
+  const auto result = quadratureAdaptive(func, 0.0, 2.0, 0.0, 1e-10);
+
+  ASSERT_EQ(result.integral.size(), frequencies.size());
+  EXPECT_TRUE(result.converged);
+  EXPECT_LE(result.error, 1e-10 * result.integral.lpNorm<Eigen::Infinity>());
+
+  for (Index i = 0; i < frequencies.size(); i++) {
+	const double k = frequencies[i];
+	const Lambda<double(double)> bin = [k](const double x) { return cos(k * x) / (1.0 + x * x); };
+	EXPECT_NEAR(result.integral[i], quadratureAdaptive(bin, 0.0, 2.0, 1e-13).integral, 1e-9);
+  }
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveVectorArray) {
+  const auto fixed = [](const double x) { return Eigen::Array<double, 2, 1> {x, x * x}; };
+
+  const auto result = quadratureAdaptive(fixed, 0.0, 2.0, 1e-12);
+  EXPECT_TRUE(result.converged);
+  EXPECT_NEAR(result.integral[0], 2.0, 1e-12);
+  EXPECT_NEAR(result.integral[1], 8.0 / 3.0, 1e-12);
+
+  // Array expressions are integrated as their plain array
+  const Eigen::ArrayXd frequencies = Eigen::ArrayXd::LinSpaced(3, 1.0, 3.0);
+  const auto expression = [&frequencies](const double x) { return (frequencies * x).cos(); };
+
+  const auto bins = quadratureAdaptive(expression, 0.0, 1.0, 1e-12);
+  static_assert(std::is_same_v<decltype(bins.integral), Eigen::ArrayXd>);
+  ASSERT_EQ(bins.integral.size(), 3);
+  for (Index i = 0; i < 3; i++) {
+	EXPECT_NEAR(bins.integral[i], sin(frequencies[i]) / frequencies[i], 1e-12);
+  }
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveReversed) {
+  const Lambda<double(double)> func = [](const double x) { return sin(1.0 / (x + 1e-2)); };
+
+  const auto forward = quadratureAdaptive(func, 0.0, 1.0, 1e-10);
+  const auto reversed = quadratureAdaptive(func, 1.0, 0.0, 1e-10);
+
+  // Same partition, mirrored
+  EXPECT_TRUE(forward.converged);
+  EXPECT_TRUE(reversed.converged);
+  EXPECT_EQ(reversed.intervals, forward.intervals);
+  EXPECT_NEAR(reversed.integral, -forward.integral, 1e-10);
+  EXPECT_NEAR(reversed.integral, -quadratureA(func, 0.0, 1.0, 1e-12), 1e-9);
+
+  const BatchIntegrand<double> batch = [&func](const VectorX<double>& x) {
+	return VectorX<double>(x.unaryExpr(func));
+  };
+  EXPECT_NEAR(quadratureAdaptive(batch, 1.0, 0.0, 1e-10).integral, reversed.integral, 1e-14);
+
+  const auto vector = [&func](const double x) { return Vector2X<double> {func(x), 2.0 * func(x)}; };
+  const auto vector_result = quadratureAdaptive(vector, 1.0, 0.0, 1e-10);
+  EXPECT_TRUE(vector_result.converged);
+  EXPECT_NEAR(vector_result.integral[1], 2.0 * reversed.integral, 2e-10);
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveDefaultBudget) {
+  // Never converges, so the default budget is used up
+  const Lambda<double(double)> func = [](const double x) { return 1.0 / abs(x - 1.0 / 3.0); };
+
+  const auto result = quadratureAdaptive(func, 0.0, 1.0, 1e-14);
+
+  EXPECT_FALSE(result.converged);
+  EXPECT_LE(result.evaluations, 21000);
+  EXPECT_LE(result.intervals, 500);
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveSingularity) {
+  Index calls = 0;
+  const Lambda<double(double)> func = [&calls](const double x) {
+	calls++;
+	return 1.0 / sqrt(x);
+  };
+
+  const auto result = quadratureAdaptive(func, 0.0, 1.0, 1e-10);
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_EQ(result.evaluations, calls);
+  EXPECT_NEAR(result.integral, 2.0, 1e-10);
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveRelative) {
+  const Lambda<double(double)> func = [](const double x) { return 1e6 * exp(x); };
+
+  const auto result = quadratureAdaptive(func, 0.0, 3.0, 0.0, 1e-12);
+
+  EXPECT_TRUE(result.converged);
+  EXPECT_NEAR(result.integral, 1e6 * (exp(3.0) - 1.0), 1e-12 * 1e6 * exp(3.0));
+}
+
+TEST(QuadratureTest, QuadratureAdaptiveBudget) {
+  Index calls = 0;
+  const Lambda<double(double)> func = [&calls](const double x) {
+	calls++;
+	return sin(1.0 / (x + 1e-3));
+  };
+
+  const auto result = quadratureAdaptive(func, 0.0, 1.0, 1e-14, 0.0, 210);
+
+  EXPECT_FALSE(result.converged);
+  EXPECT_LE(result.evaluations, 210);
+  EXPECT_EQ(result.evaluations, calls);
+  EXPECT_GT(result.error, 1e-14);
+}
+
+TEST(QuadratureTest, QuadratureBatch) {
+  const Lambda<double(double)> func = [](const double x) {
+	return -exp(-sqrt2 * x) - 0.05 * exp(0.5 * cos(20 * pi * x)) + 1 + e / 20;
+  };
+
+  Index calls = 0;
+  Index nodes = 0;
+  const BatchIntegrand<double> batch = [&](const VectorX<double>& x) {
+	calls++;
+	nodes += x.size();
+	return VectorX<double>(x.unaryExpr(func));
+  };
+
+  constexpr double tol = 1e-8;
+  constexpr double expected_result = 0.54754263323770047;
+
+  const double result = quadratureA(batch, 0.0, 1.0, tol);
+
+  EXPECT_NEAR(result, expected_result, tol);
+  EXPECT_NEAR(result, quadratureA(func, 0.0, 1.0, tol), 1e-13);
+  EXPECT_EQ(nodes % 21, 0);
+  EXPECT_LT(calls, nodes / 21);
+
+  calls = 0;
+  nodes = 0;
+  const auto adaptive = quadratureAdaptive(batch, 0.0, 1.0, 1e-12);
+  const auto scalar = quadratureAdaptive(func, 0.0, 1.0, 1e-12);
+
+  // Same partition, both halves of a bisection in one call
+  EXPECT_TRUE(adaptive.converged);
+  EXPECT_EQ(adaptive.intervals, scalar.intervals);
+  EXPECT_EQ(adaptive.evaluations, nodes);
+  EXPECT_EQ(calls, adaptive.intervals);
+  EXPECT_NEAR(adaptive.integral, scalar.integral, 1e-14);
+}
+
+TEST(QuadratureTest, QuadratureBatchSharesNodes) {
+  Index calls = 0;
+  const BatchIntegrand<double> func = [&calls](const VectorX<double>& x) {
+	calls++;
+	return VectorX<double>(x.array().square().square());
+  };
+
+  const double result = quadratureA(func, 0.0, 2.0, 1e-8);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_NEAR(result, 32.0 / 5.0, 1e-12);
+}
+
+TEST(QuadratureTest, QuadratureBatchCallable) {
+  // Taken directly, without wrapping in a 'BatchIntegrand'
+  const auto func = [](const VectorX<double>& x) {
+	return VectorX<double>(x.array().sin() * x.array());
+  };
+  const BatchIntegrand<double> erased = func;
+
+  EXPECT_EQ(quadratureA(func, 0.0, 1.0), quadratureA(erased, 0.0, 1.0));
+  EXPECT_EQ(quadratureAdaptive(func, 0.0, 1.0, 1e-12).integral,
+			quadratureAdaptive(erased, 0.0, 1.0, 1e-12).integral);
+  EXPECT_EQ(quadratureG1(func, 0.0, 1.0), quadratureG1(erased, 0.0, 1.0));
+  EXPECT_EQ(quadratureG2(func, 0.0, 1.0), quadratureG2(erased, 0.0, 1.0));
+  EXPECT_EQ(quadratureG3(func, 0.0, 1.0), quadratureG3(erased, 0.0, 1.0));
+  EXPECT_NEAR(quadratureA(func, 0.0, 1.0, 1e-12), sin(1.0) - cos(1.0), 1e-12);
+
+  // Scalar type deduced from the bounds
+  const auto func_f = [](const VectorX<float>& x) { return VectorX<float>(x.array().square()); };
+  EXPECT_NEAR(quadratureA(func_f, 0.0f, 3.0f, 1e-4f), 9.0f, 1e-4f);
+}
+
 TEST(QuadratureTest, QuadratureG1Test) {
   const Lambda<double(double)> func = [](const double x) { return x; };
 
@@ -58,4 +355,20 @@ TEST(QuadratureTest, QuadratureG3Test) {
   EXPECT_NEAR(result, expected_result, 1e-8);
 }
 
+TEST(QuadratureTest, QuadratureGBatch) {
+  Index calls = 0;
+  const BatchIntegrand<double> func = [&calls](const VectorX<double>& x) {
+	calls++;
+	return VectorX<double>(x.array().cube() + x.array());
+  };
+
+  constexpr double a = 1.0;
+  constexpr double b = 3.0;
+
+  EXPECT_NEAR(quadratureG1(func, a, b), 2.0 * (8.0 + 2.0), 1e-12);
+  EXPECT_NEAR(quadratureG2(func, a, b), 20.0 + 4.0, 1e-8);
+  EXPECT_NEAR(quadratureG3(func, a, b), 20.0 + 4.0, 1e-8);
+  EXPECT_EQ(calls, 3);
+}
+
 } // namespace nuenv::test
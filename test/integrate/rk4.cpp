@@ -1,11 +1,14 @@
 #include "nuenv/src/integrate/rk4.hpp"
 
 #include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/lambda.hpp"
 #include "nuenv/src/core/math.hpp"
 #include "nuenv/src/integrate/ode_solution.hpp"
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace nuenv::test {
 
 TEST(RK4Test, FirstOrderIter) {
@@ -181,4 +184,56 @@ TEST(RK4Test, SystemSolve) {
   }
 }
 
+TEST(RK4Test, SolveView) {
+  class ODESystem {
+   public:
+	double operator()(const double t, const double x) const {
+	  return x - Pow2(t) + 1;
+	}
+  };
+
+  constexpr ODESystem ode_system;
+  Rk4<double, double, ODESystem> rk4(ode_system);
+
+  const std::vector<double> t_eval = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5};
+  MatrixSQX<double> times(t_eval.size(), 2);
+  times.col(1) = AsVector(t_eval);
+
+  const auto expected = rk4.solve(VectorX<double>(AsVector(t_eval)), 0.5);
+  const auto from_buffer = rk4.solve(AsVector(t_eval), 0.5);
+  const auto from_column = rk4.solve(times.col(1), 0.5);
+
+  EXPECT_EQ(from_buffer.t, expected.t);
+  EXPECT_EQ(from_buffer.x, expected.x);
+  EXPECT_EQ(from_column.x, expected.x);
+}
+
+TEST(RK4Test, StopEvent) {
+  class ODESystem {
+   public:
+	double operator()(const double t, const double x) const {
+	  return x - Pow2(t) + 1;
+	}
+  };
+
+  constexpr ODESystem ode_system;
+  Rk4<double, double, ODESystem> rk4(ode_system);
+
+  const VectorX<double> t_eval = VectorX<double>::LinSpaced(11, 0.0, 1.0);
+
+  const auto stop = [](const double x) { return x > 1.0; };
+  const Lambda<bool(double)> erased = stop;
+
+  const auto result = rk4.solve(t_eval, 0.5, stop);
+  const auto from_lambda = rk4.solve(t_eval, 0.5, erased);
+  const auto from_ref = rk4.solve(t_eval, 0.5, FunctionRef<bool(double)>(stop));
+
+  // Stops at the first state above 1, at t = 0.3
+  ASSERT_EQ(result.t.size(), 4);
+  EXPECT_GT(result.x[3], 1.0);
+  EXPECT_LE(result.x[2], 1.0);
+  EXPECT_EQ(from_lambda.x, result.x);
+  EXPECT_EQ(from_ref.x, result.x);
+}
+
 } // namespace nuenv::test
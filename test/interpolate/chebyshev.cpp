@@ -0,0 +1,175 @@
+#include "nuenv/src/interpolate/chebyshev.hpp"
+
+#include "nuenv/src/algorithm/space.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/core/math.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+TEST(ChebyshevTest, Exponential) {
+  Index calls = 0;
+  const Lambda<double(double)> func = [&calls](const double x) {
+	calls++;
+	return exp(x);
+  };
+
+  const Chebyshev<double> approx(func, -1.0, 2.0);
+
+  EXPECT_TRUE(approx.converged());
+  EXPECT_LE(approx.degree(), 32);
+  EXPECT_EQ(calls, approx.degree() < 16 ? 17 : 33);
+
+  for (double x = -1.0; x <= 2.0; x += 0.0137) {
+	EXPECT_NEAR(approx.evaluate(x), exp(x), 1e-13 * exp(2.0));
+  }
+
+  EXPECT_NEAR(approx.evaluate(-1.0), exp(-1.0), 1e-13);
+  EXPECT_NEAR(approx.evaluate(2.0), exp(2.0), 1e-13);
+}
+
+TEST(ChebyshevTest, Polynomial) {
+  const Lambda<double(double)> func = [](const double x) { return 1.0 + x * (2.0 - 3.0 * x * x); };
+
+  const Chebyshev<double> approx(func, 0.0, 4.0);
+
+  EXPECT_EQ(approx.degree(), 3);
+  EXPECT_NEAR(approx.evaluate(3.0), func(3.0), 1e-12);
+}
+
+TEST(ChebyshevTest, Batch) {
+  const Lambda<double(double)> func = [](const double x) { return sin(5.0 * x) / (1.0 + x * x); };
+
+  const Chebyshev<double> approx(func, -3.0, 3.0);
+
+  // Not a multiple of the block size
+  const VectorX<double> x = VectorX<double>::LinSpaced(1001, -3.0, 3.0);
+  const VectorX<double> y = approx.evaluate(x);
+
+  ASSERT_EQ(y.size(), x.size());
+  for (Index i = 0; i < x.size(); i++) {
+	EXPECT_NEAR(y[i], approx.evaluate(x[i]), 1e-14);
+	EXPECT_NEAR(y[i], func(x[i]), 1e-12);
+  }
+}
+
+TEST(ChebyshevTest, BatchRange) {
+  const Lambda<double(double)> func = [](const double x) { return abs(x) + x * x; };
+
+  const Chebyshev<double> approx(func, -3.0, 3.0);
+  const PiecewiseChebyshev<double> piecewise(func, -3.0, 3.0);
+
+  const auto view = LinearSpaceView(-3.0, 3.0, 1001);
+  const VectorX<double> y = approx.evaluate(view);
+  VectorX<double> z;
+  piecewise.evaluate(view, z);
+
+  ASSERT_EQ(y.size(), 1001);
+  ASSERT_EQ(z.size(), 1001);
+  for (Index i = 0; i < y.size(); i++) {
+	EXPECT_NEAR(y[i], approx.evaluate(view[i]), 1e-14);
+	EXPECT_NEAR(z[i], piecewise.evaluate(view[i]), 1e-14);
+  }
+}
+
+TEST(ChebyshevTest, Calculus) {
+  const Lambda<double(double)> func = [](const double x) { return cos(x) * exp(x / 2.0); };
+  const Lambda<double(double)> dfunc = [](const double x) {
+	return (cos(x) / 2.0 - sin(x)) * exp(x / 2.0);
+  };
+  const Lambda<double(double)> primitive = [](const double x) {
+	return (2.0 * cos(x) + 4.0 * sin(x)) * exp(x / 2.0) / 5.0;
+  };
+
+  constexpr double a = 0.5;
+  constexpr double b = 3.0;
+
+  const Chebyshev<double> approx(func, a, b);
+  const Chebyshev<double> derivative = approx.derivative();
+  const Chebyshev<double> antiderivative = approx.antiderivative();
+
+  EXPECT_EQ(derivative.degree(), approx.degree() - 1);
+  EXPECT_EQ(antiderivative.degree(), approx.degree() + 1);
+
+  for (double x = a; x <= b; x += 0.0271) {
+	EXPECT_NEAR(derivative.evaluate(x), dfunc(x), 1e-11);
+	EXPECT_NEAR(antiderivative.evaluate(x), primitive(x) - primitive(a), 1e-13);
+  }
+
+  EXPECT_NEAR(approx.integral(), primitive(b) - primitive(a), 1e-13);
+  EXPECT_NEAR(approx.integral(1.0, 2.0), primitive(2.0) - primitive(1.0), 1e-13);
+  EXPECT_NEAR(antiderivative.evaluate(b), approx.integral(), 1e-13);
+}
+
+TEST(ChebyshevTest, MaxDegree) {
+  const Lambda<double(double)> func = [](const double x) { return abs(x - 0.3); };
+
+  const Chebyshev<double> approx(func, -1.0, 1.0, 1e-13, 64);
+
+  EXPECT_FALSE(approx.converged());
+  EXPECT_EQ(approx.degree(), 64);
+}
+
+TEST(PiecewiseChebyshevTest, Kink) {
+  const Lambda<double(double)> func = [](const double x) { return abs(x) + x * x; };
+
+  const PiecewiseChebyshev<double> approx(func, -1.0, 1.0);
+
+  // Split exactly at the kink
+  EXPECT_TRUE(approx.converged());
+  ASSERT_EQ(approx.pieces().size(), 2);
+  EXPECT_DOUBLE_EQ(approx.breakpoints()[1], 0.0);
+
+  for (double x = -1.0; x <= 1.0; x += 0.0113) {
+	EXPECT_NEAR(approx.evaluate(x), func(x), 1e-14);
+  }
+
+  EXPECT_NEAR(approx.integral(), 1.0 + 2.0 / 3.0, 1e-14);
+}
+
+TEST(PiecewiseChebyshevTest, SteepFront) {
+  const Lambda<double(double)> func = [](const double x) { return tanh(200.0 * (x - 0.1)); };
+
+  const PiecewiseChebyshev<double> approx(func, -1.0, 1.0, 1e-13, 64);
+
+  EXPECT_TRUE(approx.converged());
+  EXPECT_GT(approx.pieces().size(), 2);
+
+  const VectorX<double> x = VectorX<double>::LinSpaced(2000, -1.0, 1.0);
+  const VectorX<double> y = approx.evaluate(x);
+
+  for (Index i = 0; i < x.size(); i++) {
+	EXPECT_NEAR(y[i], func(x[i]), 1e-12);
+	EXPECT_DOUBLE_EQ(y[i], approx.evaluate(x[i]));
+  }
+
+  // Unsorted points
+  const VectorX<double> reversed = x.reverse();
+  const VectorX<double> z = approx.evaluate(reversed);
+  EXPECT_TRUE(z.isApprox(y.reverse(), 1e-15));
+
+  // The exact integral is log(cosh) / 200 evaluated at the bounds
+  const double expected = (log(cosh(200.0 * 0.9)) - log(cosh(200.0 * 1.1))) / 200.0;
+  EXPECT_NEAR(approx.integral(), expected, 1e-12);
+}
+
+TEST(PiecewiseChebyshevTest, Calculus) {
+  const Lambda<double(double)> func = [](const double x) { return x < 0.0 ? -x * x : x * x; };
+
+  const PiecewiseChebyshev<double> approx(func, -1.0, 1.0);
+  const PiecewiseChebyshev<double> derivative = approx.derivative();
+  const PiecewiseChebyshev<double> antiderivative = approx.antiderivative();
+
+  for (double x = -1.0; x <= 1.0; x += 0.0173) {
+	EXPECT_NEAR(derivative.evaluate(x), 2.0 * abs(x), 1e-12);
+	EXPECT_NEAR(antiderivative.evaluate(x), (abs(x) * x * x - 1.0) / 3.0, 1e-14);
+  }
+
+  // Copies rebuild their search index
+  PiecewiseChebyshev<double> copy = approx;
+  copy = derivative;
+  EXPECT_NEAR(copy.evaluate(0.5), 1.0, 1e-12);
+}
+
+}
@@ -0,0 +1,148 @@
+#include "nuenv/src/interpolate/cubic.hpp"
+
+#include "nuenv/src/algorithm/space.hpp"
+#include "nuenv/src/core/container.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+const VectorX<double> kNodes = VectorX<double>::LinSpaced(11, 0.0, 2.0).array().square();
+
+double cubic(double x) { return 1.0 - 2.0 * x + 0.5 * x * x - 0.25 * x * x * x; }
+
+double cubicDerivative(double x) { return -2.0 + x - 0.75 * x * x; }
+
+TEST(CubicTest, SplineNotAKnotReproducesCubic) {
+  const VectorX<double> y = kNodes.unaryExpr(&cubic);
+  const SplineInterp1d<double> interp(kNodes, y);
+
+  for (double x : {0.0, 0.01, 0.3, 1.7, 2.5, 3.99, 4.0}) {
+	EXPECT_NEAR(interp.evaluate(x), cubic(x), 1e-10);
+  }
+}
+
+TEST(CubicTest, SplineClampedReproducesCubic) {
+  const VectorX<double> y = kNodes.unaryExpr(&cubic);
+  const SplineInterp1d<double> interp(kNodes, y, cubicDerivative(0.0), cubicDerivative(4.0));
+
+  for (double x : {0.0, 0.01, 0.3, 1.7, 2.5, 3.99, 4.0}) {
+	EXPECT_NEAR(interp.evaluate(x), cubic(x), 1e-10);
+  }
+}
+
+TEST(CubicTest, SplineNatural) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(101, 0.0, 3.0);
+  const VectorX<double> y = x.array().sin();
+  const SplineInterp1d<double> interp(x, y, SplineBoundary::Natural);
+
+  // The zero end curvature only spoils the accuracy near the ends
+  for (double t = 0.5; t < 2.5; t += 0.0137) {
+	EXPECT_NEAR(interp.evaluate(t), sin(t), 1e-7);
+  }
+
+  // A line is reproduced exactly
+  const SplineInterp1d<double> line(x, 3.0 * x, SplineBoundary::Natural);
+  EXPECT_NEAR(line.evaluate(1.2345), 3.7035, 1e-12);
+}
+
+TEST(CubicTest, SplineSmallSizes) {
+  const Vector2X<double> x2(1.0, 3.0);
+  const Vector2X<double> y2(2.0, 6.0);
+  EXPECT_NEAR(SplineInterp1d<double>(x2, y2).evaluate(2.5), 5.0, 1e-12);
+  EXPECT_NEAR(SplineInterp1d<double>(x2, y2, SplineBoundary::Natural).evaluate(2.5), 5.0, 1e-12);
+
+  // Not-a-knot through 3 points is their parabola
+  const Vector3X<double> x3(0.0, 1.0, 3.0);
+  const Vector3X<double> y3 = x3.array().square();
+  EXPECT_NEAR(SplineInterp1d<double>(x3, y3).evaluate(2.0), 4.0, 1e-12);
+}
+
+TEST(CubicTest, PchipMonotone) {
+  VectorX<double> x(8), y(8);
+  x << 0.0, 1.0, 2.0, 3.0, 3.5, 5.0, 6.0, 9.0;
+  y << 0.0, 0.0, 0.1, 5.0, 5.0, 5.2, 9.0, 9.0;
+  const PchipInterp1d<double> interp(x, y);
+
+  double prev = interp.evaluate(0.0);
+  for (double t = 0.0; t <= 9.0; t += 0.001) {
+	double value = interp.evaluate(t);
+	EXPECT_GE(value, prev - 1e-12) << t;
+	prev = value;
+  }
+
+  // Flat segments stay flat
+  EXPECT_DOUBLE_EQ(interp.evaluate(0.5), 0.0);
+  EXPECT_DOUBLE_EQ(interp.evaluate(7.5), 9.0);
+  EXPECT_NEAR(interp.evaluate(3.25), 5.0, 1e-12);
+}
+
+TEST(CubicTest, AkimaLocal) {
+  VectorX<double> x = VectorX<double>::LinSpaced(12, 0.0, 11.0);
+  VectorX<double> y = 2.0 * x;
+  y[6] += 10.0;
+  const AkimaInterp1d<double> interp(x, y);
+
+  // The outlier only affects the 2 neighbouring points on each side
+  EXPECT_NEAR(interp.evaluate(1.5), 3.0, 1e-12);
+  EXPECT_NEAR(interp.evaluate(2.5), 5.0, 1e-12);
+  EXPECT_NEAR(interp.evaluate(9.5), 19.0, 1e-12);
+  EXPECT_DOUBLE_EQ(interp.evaluate(6.0), 22.0);
+}
+
+TEST(CubicTest, BatchMatchesScalar) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(301, 0.0, 3.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+
+  const SplineInterp1d<double> spline(x, y, SplineBoundary::NotAKnot, false);
+  const PchipInterp1d<double> pchip(x, y, false);
+  const AkimaInterp1d<double> akima(x, y, false);
+
+  const VectorX<double> sorted = VectorX<double>::LinSpaced(1001, -1.0, 10.0);
+  const VectorX<double> unsorted = sorted.reverse();
+
+  for (const HermiteInterp1d<double>* interp : {static_cast<const HermiteInterp1d<double>*>(&spline),
+												static_cast<const HermiteInterp1d<double>*>(&pchip),
+												static_cast<const HermiteInterp1d<double>*>(&akima)}) {
+	const VectorX<double> values = interp->evaluate(sorted);
+	for (Index i = 0; i < sorted.size(); i++) {
+	  EXPECT_NEAR(values[i], interp->evaluate(sorted[i]), 1e-12);
+	}
+
+	VectorX<double> out;
+	interp->evaluate(unsorted, out);
+	EXPECT_EQ(out, values.reverse());
+  }
+}
+
+TEST(CubicTest, BatchRange) {
+  // Table read from the middle of larger vectors
+  const VectorX<double> x = VectorX<double>::LinSpaced(303, -0.01, 3.01).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+
+  const PchipInterp1d<double> pchip(x.segment(1, 301), y.segment(1, 301), false);
+  const VectorX<double> table_x = x.segment(1, 301), table_y = y.segment(1, 301);
+  const PchipInterp1d<double> copied(table_x, table_y, false);
+
+  const auto view = LinearSpaceView(-1.0, 10.0, 1001);
+  const VectorX<double> values = pchip.evaluate(view);
+
+  ASSERT_EQ(values.size(), 1001);
+  for (Index i = 0; i < values.size(); i++) {
+	EXPECT_EQ(values[i], copied.evaluate(view[i]));
+  }
+}
+
+TEST(CubicTest, Copy) {
+  const VectorX<double> y = kNodes.unaryExpr(&cubic);
+
+  SplineInterp1d<double> copy(kNodes, kNodes);
+  {
+	const SplineInterp1d<double> interp(kNodes, y);
+	copy = interp;
+  }
+
+  EXPECT_NEAR(copy.evaluate(1.7), cubic(1.7), 1e-10);
+}
+
+} // namespace nuenv::test
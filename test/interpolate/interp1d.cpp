@@ -1,7 +1,12 @@
 #include "nuenv/src/interpolate/interp1d.hpp"
 
+#include "nuenv/src/algorithm/space.hpp"
+
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 namespace nuenv::test {
 
 TEST(Interp1dTest, LinearSorted) {
@@ -37,4 +42,235 @@ TEST(Interp1dTest, ExponentialSortedOOB) {
   EXPECT_NEAR(interp.exponential(4.0), y[2], 1e-8);
 }
 
+TEST(Interp1dTest, LinearLargeCopy) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(101, 0.0, 10.0);
+  const VectorX<double> y = 2.0 * x;
+
+  Interp1d<double> copy(x, x);
+  {
+	const Interp1d<double> interp(x, y, true);
+	copy = interp;
+  }
+
+  EXPECT_NEAR(copy.linear(3.14), 6.28, 1e-8);
+  EXPECT_NEAR(copy.linear(9.99), 19.98, 1e-8);
+}
+
+TEST(Interp1dTest, LinearGrid) {
+  const LogarithmicGrid<double> x(1.0, 1e4, 401);
+  const VectorX<double> y = x.toVector().array().log();
+  Interp1d<double> interp(x, y, true);
+
+  EXPECT_NEAR(interp.linear(1.0), 0.0, 1e-8);
+  EXPECT_NEAR(interp.linear(100.0), log(100.0), 1e-4);
+  EXPECT_NEAR(interp.linear(2500.0), log(2500.0), 1e-4);
+}
+
+TEST(Interp1dTest, LinearCursorSweep) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(201, 0.0, 2.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  Interp1d<double> interp(x, y, true);
+  SearchCursor cursor;
+
+  const VectorX<double> t = VectorX<double>::LinSpaced(1001, 0.0, 4.0);
+  for (Index i = 0; i < t.size(); i++) {
+	EXPECT_DOUBLE_EQ(interp.linear(t[i], cursor), interp.linear(t[i]));
+	EXPECT_DOUBLE_EQ(interp.exponential(t[i] + 1.0, cursor),
+					 interp.exponential(t[i] + 1.0));
+  }
+}
+
+TEST(Interp1dTest, LinearUpperBound) {
+  const VectorX_s<double, 3> x = {1.0, 2.0, 3.0};
+  const VectorX_s<double, 3> y = {10.0, 20.0, 30.0};
+  Interp1d<double> interp(x, y, true);
+
+  EXPECT_DOUBLE_EQ(interp.linear(3.0), 30.0);
+  EXPECT_DOUBLE_EQ(interp.exponential(3.0), 30.0);
+}
+
+TEST(Interp1dTest, LinearBatch) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(301, 0.0, 3.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  Interp1d<double> interp(x, y, false);
+
+  // Sorted, spanning several blocks and past both bounds
+  const VectorX<double> sorted = VectorX<double>::LinSpaced(1001, -1.0, 10.0);
+  const VectorX<double> values = interp.linear(sorted);
+  ASSERT_EQ(values.size(), sorted.size());
+  for (Index i = 0; i < sorted.size(); i++) {
+	EXPECT_DOUBLE_EQ(values[i], interp.linear(sorted[i]));
+  }
+
+  const VectorX<double> unsorted = sorted.reverse();
+  VectorX<double> out;
+  interp.linear(unsorted, out);
+  EXPECT_EQ(out, values.reverse());
+
+  // A NaN in front of sorted points does not shift the segments of the others
+  VectorX<double> with_nan = sorted;
+  with_nan[0] = numeric_limits<double>::quiet_NaN();
+  interp.linear(with_nan, out);
+  EXPECT_EQ(out.tail(1000), values.tail(1000));
+}
+
+TEST(Interp1dTest, BatchRange) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(301, 0.0, 3.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  Interp1d<double> interp(x, y, false);
+
+  // Lazy views and standard containers are read without materializing a vector
+  const auto view = LinearSpaceView(0.0, 1.0, 100);
+  const VectorX<double> values = interp.linear(view);
+  ASSERT_EQ(values.size(), 100);
+  for (Index i = 0; i < values.size(); i++) {
+	EXPECT_DOUBLE_EQ(values[i], interp.linear(view[i]));
+  }
+
+  const std::vector<double> points(100, 0.5);
+  VectorX<double> out;
+  interp.exponential(points, out);
+  EXPECT_EQ(out, VectorX<double>::Constant(100, interp.exponential(0.5)));
+}
+
+TEST(Interp1dTest, ExponentialBatch) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(301, 0.0, 3.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  Interp1d<double> interp(x, y, false);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(777, -1.0, 10.0).reverse();
+  VectorX<double> out(3);
+  interp.exponential(queries, out);
+  ASSERT_EQ(out.size(), queries.size());
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_NEAR(out[i], interp.exponential(queries[i]), 1e-12);
+  }
+
+  EXPECT_DOUBLE_EQ(out[0], y[300]);
+  EXPECT_DOUBLE_EQ(out[776], y[0]);
+}
+
+TEST(Interp1dTest, LinearBatchGrid) {
+  const LogarithmicGrid<double> x(1.0, 1e4, 401);
+  const VectorX<double> y = x.toVector().array().log();
+  Interp1d<double> interp(x, y, true);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(64, 1.0, 1e4);
+  const VectorX<double> values = interp.linear(queries);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_DOUBLE_EQ(values[i], interp.linear(queries[i]));
+  }
+}
+
+TEST(Interp1dTest, PrecomputedSegments) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(301, 0.0, 3.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  Interp1d<double> plain(x, y, false);
+  Interp1d<double> precomputed(x, y, false, true);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(1001, -1.0, 10.0);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_NEAR(precomputed.linear(queries[i]), plain.linear(queries[i]), 1e-12);
+	EXPECT_NEAR(precomputed.exponential(queries[i]), plain.exponential(queries[i]), 1e-12);
+  }
+
+  EXPECT_DOUBLE_EQ(precomputed.linear(0.0), y[0]);
+  EXPECT_DOUBLE_EQ(precomputed.exponential(9.0), y[300]);
+
+  const VectorX<double> linear = precomputed.linear(queries);
+  const VectorX<double> exponential = precomputed.exponential(queries);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_NEAR(linear[i], plain.linear(queries[i]), 1e-12);
+	EXPECT_NEAR(exponential[i], plain.exponential(queries[i]), 1e-12);
+  }
+
+  Interp1d<double> copy(precomputed);
+  EXPECT_DOUBLE_EQ(copy.linear(4.321), precomputed.linear(4.321));
+  copy = plain;
+  EXPECT_DOUBLE_EQ(copy.linear(4.321), plain.linear(4.321));
+}
+
+TEST(Interp1dTest, ConcurrentReaders) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(100001, 0.0, 10.0).array().square();
+  const VectorX<double> y = 2.0 + x.array().sin();
+  const Interp1d<double> interp(x, y, false, true);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(20000, -1.0, 101.0);
+
+  VectorX<double> expected;
+  interp.linear(queries, expected);
+
+  // Every thread shares the interpolator and keeps its own cursor
+  constexpr Index kThreads = 8;
+  VectorT<VectorX<double>> results(kThreads, VectorX<double>(queries.size()));
+  VectorT<VectorX<double>> batches(kThreads);
+  VectorT<std::thread> threads;
+
+  for (Index t = 0; t < kThreads; t++) {
+	threads.emplace_back([&, t]() {
+	  const Interp1d<double>& shared = interp;
+	  SearchCursor cursor;
+
+	  for (Index i = 0; i < queries.size(); i++) {
+		Index k = (i * 7919 + t) % queries.size();
+		results[t][k] = t % 2 == 0 ? shared.linear(queries[k]) : shared.linear(queries[k], cursor);
+	  }
+
+	  shared.linear(queries, batches[t]);
+	});
+  }
+
+  for (auto& thread : threads) { thread.join(); }
+
+  for (Index t = 0; t < kThreads; t++) {
+	EXPECT_EQ(results[t], expected);
+	EXPECT_EQ(batches[t], expected);
+  }
+}
+
+TEST(Interp1dTest, View) {
+  std::vector<double> x(1000), y(1000);
+  for (size_t i = 0; i < x.size(); i++) {
+	x[i] = sqrt(static_cast<double>(i));
+	y[i] = 1.0 + x[i] * x[i];
+  }
+
+  const Interp1d<double> owned(AsVector(x), AsVector(y));
+  const Interp1dView<double> view(AsVector(x), AsVector(y));
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(777, -1.0, 33.0);
+  for (double q : queries) {
+	EXPECT_EQ(view.linear(q), owned.linear(q));
+	EXPECT_EQ(view.exponential(q), owned.exponential(q));
+  }
+
+  EXPECT_EQ(view.linear(queries), owned.linear(queries));
+  EXPECT_EQ(view.exponential(queries), owned.exponential(queries));
+
+  // The view follows changes to the caller memory
+  y[500] += 1.0;
+  EXPECT_NE(view.linear(x[500]), owned.linear(x[500]));
+  EXPECT_DOUBLE_EQ(view.linear(x[500]), y[500]);
+}
+
+TEST(Interp1dTest, ViewColumns) {
+  MatrixSQX<double> table(64, 3);
+  table.col(0) = VectorX<double>::LinSpaced(64, 0.0, 1.0);
+  table.col(1) = table.col(0).array().exp();
+  table.col(2) = table.col(0).array().square();
+
+  Interp1dView<double> view(AsVector(table.col(0)), AsVector(table.col(1)));
+  const Interp1dView<double> other(AsVector(table.col(0)), AsVector(table.col(2)));
+  const Interp1d<double> owned(table.col(0), table.col(2));
+
+  EXPECT_NEAR(view.exponential(0.3), exp(0.3), 1e-12);
+
+  view = other;
+  EXPECT_EQ(view.linear(0.3), owned.linear(0.3));
+  EXPECT_EQ(table(10, 1), exp(table(10, 0)));
+
+  const Interp1dView<double> copy(view);
+  EXPECT_EQ(copy.linear(0.7), owned.linear(0.7));
+}
+
 } // namespace nuenv::test
@@ -0,0 +1,111 @@
+#include "nuenv/src/interpolate/interpnd.hpp"
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/interpolate/interp1d.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+// Multilinear functions are reproduced exactly by multilinear interpolation
+double bilinear(double x, double y) { return 1.0 + 2.0 * x - 3.0 * y + 0.5 * x * y; }
+
+double trilinear(double x, double y, double z) {
+  return bilinear(x, y) + z * (4.0 - x + 2.0 * x * y);
+}
+
+TEST(InterpNdTest, Bilinear) {
+  const VectorX<double> ax = VectorX<double>::LinSpaced(11, 0.0, 2.0).array().square();
+  const VectorX<double> ay = VectorX<double>::LinSpaced(7, -1.0, 2.0);
+
+  VectorX<double> values(ax.size() * ay.size());
+  for (Index i = 0; i < ax.size(); i++) {
+	for (Index j = 0; j < ay.size(); j++) {
+	  values[i * ay.size() + j] = bilinear(ax[i], ay[j]);
+	}
+  }
+
+  const Interp2d<double> interp({ax, ay}, values);
+
+  for (double x : {0.0, 0.3, 1.7, 3.99, 4.0}) {
+	for (double y : {-1.0, -0.3, 0.5, 1.99, 2.0}) {
+	  EXPECT_NEAR(interp.linear(Vector2X<double>(x, y)), bilinear(x, y), 1e-12);
+	}
+  }
+}
+
+TEST(InterpNdTest, TrilinearBatch) {
+  const VectorX<double> ax = VectorX<double>::LinSpaced(5, 0.0, 1.0);
+  const VectorX<double> ay = VectorX<double>::LinSpaced(9, 0.0, 3.0).array().square();
+  const VectorX<double> az = VectorX<double>::LinSpaced(4, -2.0, 2.0);
+
+  VectorX<double> values(ax.size() * ay.size() * az.size());
+  Index k = 0;
+  for (Index i = 0; i < ax.size(); i++) {
+	for (Index j = 0; j < ay.size(); j++) {
+	  for (Index l = 0; l < az.size(); l++) {
+		values[k++] = trilinear(ax[i], ay[j], az[l]);
+	  }
+	}
+  }
+
+  const Interp3d<double> interp({ax, ay, az}, values);
+
+  MatrixSQX<double> points(3, 500);
+  for (Index j = 0; j < points.cols(); j++) {
+	double t = static_cast<double>(j) / 499.0;
+	points.col(j) << t, 9.0 * t * t, 4.0 * (1.0 - t) - 2.0;
+  }
+
+  const VectorX<double> values_batch = interp.linear(points);
+  ASSERT_EQ(values_batch.size(), points.cols());
+
+  for (Index j = 0; j < points.cols(); j++) {
+	const Vector3X<double> p = points.col(j);
+	EXPECT_NEAR(values_batch[j], trilinear(p[0], p[1], p[2]), 1e-10);
+	EXPECT_DOUBLE_EQ(values_batch[j], interp.linear(p));
+  }
+}
+
+TEST(InterpNdTest, OneDimensionMatchesInterp1d) {
+  const VectorX<double> x = VectorX<double>::LinSpaced(101, 0.0, 2.0).array().square();
+  const VectorX<double> y = x.array().sin();
+
+  const InterpNd<double, 1> interp({x}, y, false);
+  Interp1d<double> reference(x, y, false);
+
+  for (double t = -1.0; t < 5.0; t += 0.0371) {
+	EXPECT_NEAR(interp.linear(VectorX_s<double, 1>(t)), reference.linear(t), 1e-12);
+  }
+}
+
+TEST(InterpNdTest, OutOfBoundsClamped) {
+  const VectorX<double> a = VectorX<double>::LinSpaced(3, 0.0, 1.0);
+
+  VectorX<double> values(9);
+  for (Index i = 0; i < 9; i++) { values[i] = bilinear(a[i / 3], a[i % 3]); }
+
+  const Interp2d<double> interp({a, a}, values, false);
+  Interp2d<double> copy(interp);
+
+  EXPECT_NEAR(copy.linear(Vector2X<double>(-1.0, 0.5)), bilinear(0.0, 0.5), 1e-12);
+  EXPECT_NEAR(copy.linear(Vector2X<double>(0.25, 7.0)), bilinear(0.25, 1.0), 1e-12);
+  EXPECT_NEAR(copy.linear(Vector2X<double>(2.0, 2.0)), bilinear(1.0, 1.0), 1e-12);
+}
+
+TEST(InterpNdTest, FourDimensions) {
+  const VectorX<double> a = VectorX<double>::LinSpaced(4, 0.0, 3.0);
+
+  // f = 1000 x0 + 100 x1 + 10 x2 + x3
+  VectorX<double> values(256);
+  for (Index i = 0; i < 256; i++) {
+	values[i] = 1000.0 * (i / 64) + 100.0 * (i / 16 % 4) + 10.0 * (i / 4 % 4) + (i % 4);
+  }
+
+  const InterpNd<double, 4> interp({a, a, a, a}, values);
+
+  EXPECT_NEAR(interp.linear(VectorX_s<double, 4>(0.5, 1.25, 2.75, 0.1)), 652.6, 1e-10);
+  EXPECT_NEAR(interp.linear(VectorX_s<double, 4>(3.0, 0.0, 3.0, 3.0)), 3033.0, 1e-10);
+}
+
+} // namespace nuenv::test
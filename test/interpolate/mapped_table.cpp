@@ -0,0 +1,140 @@
+#include "nuenv/src/interpolate/mapped_table.hpp"
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/interpolate/interp1d.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace nuenv::test {
+
+class MappedTableTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+	path = (std::filesystem::temp_directory_path()
+		/ ("nuenv_table_" + std::to_string(::getpid()) + ".bin")).string();
+
+	x = VectorX<double>::LinSpaced(1001, 0.0, 2.0).array().square();
+	y = 2.0 + x.array().sin();
+  }
+
+  void TearDown() override { std::filesystem::remove(path); }
+
+  std::string path;
+  VectorX<double> x;
+  VectorX<double> y;
+};
+
+TEST_F(MappedTableTest, RoundTrip) {
+  MatrixSQX<double> columns(x.size(), 3);
+  columns << x, y, 2.0 * y;
+  WriteTable(path, columns);
+
+  const MappedTable<double> table(path);
+  ASSERT_EQ(table.rows(), x.size());
+  ASSERT_EQ(table.cols(), 3);
+
+  for (Index j = 0; j < 3; j++) {
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(table.column(j).data()) % 64, 0u);
+	EXPECT_EQ(table.column(j), columns.col(j));
+  }
+}
+
+TEST_F(MappedTableTest, Interpolate) {
+  MatrixSQX<double> columns(x.size(), 2);
+  columns << x, y;
+  WriteTable(path, columns);
+
+  const MappedTable<double> table(path);
+  const MappedInterp1d<double> mapped(table, 0, 1, false);
+  Interp1d<double> reference(x, y, false);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(2001, -1.0, 5.0);
+  for (Index i = 0; i < queries.size(); i++) {
+	EXPECT_DOUBLE_EQ(mapped.linear(queries[i]), reference.linear(queries[i]));
+	EXPECT_DOUBLE_EQ(mapped.exponential(queries[i]), reference.exponential(queries[i]));
+  }
+
+  for (const VectorX<double>& batch : {queries, VectorX<double>(queries.reverse())}) {
+	VectorX<double> linear, exponential;
+	mapped.linear(batch, linear);
+	mapped.exponential(batch, exponential);
+
+	for (Index i = 0; i < batch.size(); i++) {
+	  EXPECT_DOUBLE_EQ(linear[i], reference.linear(batch[i]));
+	  EXPECT_DOUBLE_EQ(exponential[i], reference.exponential(batch[i]));
+	}
+  }
+
+  // A NaN in an otherwise sorted batch leaves the other points unaffected
+  VectorX<double> with_nan = queries;
+  with_nan[0] = numeric_limits<double>::quiet_NaN();
+  VectorX<double> linear;
+  mapped.linear(with_nan, linear);
+  for (Index i = 1; i < with_nan.size(); i++) {
+	EXPECT_DOUBLE_EQ(linear[i], reference.linear(with_nan[i]));
+  }
+}
+
+TEST_F(MappedTableTest, Invalid) {
+  EXPECT_THROW(MappedTable<double>(path + ".missing"), std::runtime_error);
+
+  // Wrong scalar type
+  MatrixSQX<float> columns = MatrixSQX<float>::Ones(10, 2);
+  WriteTable(path, columns);
+  EXPECT_THROW(MappedTable<double> {path}, std::runtime_error);
+  EXPECT_NO_THROW(MappedTable<float> {path});
+
+  // Truncated
+  std::filesystem::resize_file(path, 100);
+  EXPECT_THROW(MappedTable<float> {path}, std::runtime_error);
+
+  // Not a table
+  std::ofstream(path, std::ios::trunc) << std::string(128, 'x');
+  EXPECT_THROW(MappedTable<float> {path}, std::runtime_error);
+}
+
+TEST_F(MappedTableTest, OversizedHeader) {
+  MatrixSQX<double> columns(x.size(), 2);
+  columns << x, y;
+  WriteTable(path, columns);
+
+  // Overwrite the layout fields of a valid header
+  const auto patch = [this](uint64_t rows, uint64_t cols, uint64_t offset, uint64_t stride) {
+	internal::TableHeader header {};
+	std::ifstream(path, std::ios::binary).read(reinterpret_cast<char*>(&header), sizeof(header));
+	header.rows = rows;
+	header.cols = cols;
+	header.offset = offset;
+	header.stride = stride;
+	std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  };
+
+  const uint64_t stride = (x.size() * sizeof(double) + 63) / 64 * 64;
+  EXPECT_NO_THROW(MappedTable<double> {path});
+
+  // 'rows * sizeof(Scalar)' wraps to a small number
+  patch(uint64_t {1} << 61, 2, 64, stride);
+  EXPECT_THROW(MappedTable<double> {path}, std::runtime_error);
+
+  // 'offset + cols * stride' wraps to a small number
+  patch(x.size(), (uint64_t {1} << 63) / stride * 2 + 1, 64, stride);
+  EXPECT_THROW(MappedTable<double> {path}, std::runtime_error);
+
+  // Offset past the end of the file
+  patch(x.size(), 2, uint64_t {1} << 62, stride);
+  EXPECT_THROW(MappedTable<double> {path}, std::runtime_error);
+
+  // Stride wrapping 'offset + cols * stride' around exactly
+  patch(x.size(), 2, 64, uint64_t {1} << 63);
+  EXPECT_THROW(MappedTable<double> {path}, std::runtime_error);
+
+  patch(x.size(), 2, 64, stride);
+  EXPECT_NO_THROW(MappedTable<double> {path});
+}
+
+} // namespace nuenv::test
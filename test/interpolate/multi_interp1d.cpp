@@ -0,0 +1,100 @@
+#include "nuenv/src/interpolate/multi_interp1d.hpp"
+
+#include "nuenv/src/algorithm/space.hpp"
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/interpolate/interp1d.hpp"
+
+#include <gtest/gtest.h>
+
+namespace nuenv::test {
+
+class MultiInterp1dTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+	x = VectorX<double>::LinSpaced(201, 0.0, 2.0).array().square();
+	y.resize(x.size(), 5);
+	for (Index j = 0; j < y.cols(); j++) {
+	  y.col(j) = 2.0 + (static_cast<double>(j + 1) * x.array()).sin();
+	}
+  }
+
+  VectorX<double> x;
+  MatrixSQX<double> y;
+};
+
+TEST_F(MultiInterp1dTest, MatchesInterp1d) {
+  const MultiInterp1d<double> multi(x, y, false);
+  EXPECT_EQ(multi.channels(), 5);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(333, -1.0, 5.0);
+  for (Index j = 0; j < y.cols(); j++) {
+	Interp1d<double> single(x, y.col(j), false);
+
+	for (Index i = 0; i < queries.size(); i++) {
+	  EXPECT_NEAR(multi.linear(queries[i])[j], single.linear(queries[i]), 1e-12);
+	  EXPECT_NEAR(multi.exponential(queries[i])[j], single.exponential(queries[i]), 1e-12);
+	}
+  }
+}
+
+TEST_F(MultiInterp1dTest, Batch) {
+  const MultiInterp1d<double> multi(x, y, false);
+
+  const VectorX<double> queries = VectorX<double>::LinSpaced(333, -1.0, 5.0).reverse();
+  MatrixRowX<double> linear, exponential;
+  multi.linear(queries, linear);
+  multi.exponential(queries, exponential);
+
+  ASSERT_EQ(linear.rows(), queries.size());
+  ASSERT_EQ(linear.cols(), 5);
+
+  VectorX<double> out;
+  for (Index i = 0; i < queries.size(); i++) {
+	multi.linear(queries[i], out);
+	EXPECT_EQ(linear.row(i), out.transpose());
+	multi.exponential(queries[i], out);
+	EXPECT_TRUE(exponential.row(i).isApprox(out.transpose(), 1e-14));
+  }
+
+  EXPECT_EQ(linear.row(0), y.row(200));
+  EXPECT_EQ(linear.row(332), y.row(0));
+}
+
+TEST_F(MultiInterp1dTest, BatchRange) {
+  const MultiInterp1d<double> multi(x, y, false);
+
+  const auto view = LinearSpaceView(0.0, 4.0, 77);
+  MatrixRowX<double> linear;
+  multi.linear(view, linear);
+  ASSERT_EQ(linear.rows(), 77);
+
+  VectorX<double> out;
+  for (Index i = 0; i < linear.rows(); i++) {
+	multi.linear(view[i], out);
+	EXPECT_EQ(linear.row(i), out.transpose());
+  }
+}
+
+TEST_F(MultiInterp1dTest, TableBlock) {
+  // Table read from blocks of the fixture without a copy
+  const MultiInterp1d<double> block(x.segment(10, 101), y.block(10, 1, 101, 3), false);
+  const MultiInterp1d<double> multi(x, y, false);
+
+  EXPECT_EQ(block.channels(), 3);
+  for (double t = x[10]; t <= x[110]; t += 0.01) {
+	EXPECT_NEAR((block.linear(t) - multi.linear(t).segment(1, 3)).norm(), 0.0, 1e-14);
+  }
+}
+
+TEST_F(MultiInterp1dTest, Copy) {
+  MultiInterp1d<double> copy(x, MatrixSQX<double>::Zero(x.size(), 1));
+  {
+	const MultiInterp1d<double> multi(x, y);
+	copy = multi;
+  }
+
+  EXPECT_EQ(copy.channels(), 5);
+  EXPECT_NEAR(copy.linear(1.0)[2], 2.0 + sin(3.0), 1e-3);
+}
+
+} // namespace nuenv::test
@@ -0,0 +1,55 @@
+#include "nuenv/src/interpolate/static_interp1d.hpp"
+
+#include "nuenv/src/core/container.hpp"
+#include "nuenv/src/interpolate/interp1d.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace nuenv::test {
+
+constexpr StaticInterp1d<double, 4> kTable({1.0, 2.0, 4.0, 8.0}, {10.0, 20.0, 30.0, 70.0});
+
+TEST(StaticInterp1dTest, Constexpr) {
+  static_assert(kTable.linear(1.5) == 15.0);
+  static_assert(kTable.linear(3.0) == 25.0);
+  static_assert(kTable.linear(6.0) == 50.0);
+  static_assert(kTable.linear(0.0) == 10.0);
+  static_assert(kTable.linear(9.0) == 70.0);
+
+  static_assert(kTable.search(0.5) == 0);
+  static_assert(kTable.search(2.0) == 1);
+  static_assert(kTable.search(7.9) == 2);
+  static_assert(kTable.search(8.0) == 2);
+
+  EXPECT_DOUBLE_EQ(kTable.linear(8.0), 70.0);
+}
+
+TEST(StaticInterp1dTest, MatchesInterp1d) {
+  constexpr size_t N = 64;
+
+  const VectorX_s<double, N> x = VectorX_s<double, N>::LinSpaced(0.0, 2.0).array().square();
+  const VectorX_s<double, N> y = 2.0 + x.array().sin();
+
+  const StaticInterp1d<double, N> interp(x, y, false);
+  Interp1d<double> reference(x, y, false);
+
+  for (double t = -1.0; t < 5.0; t += 0.00731) {
+	EXPECT_DOUBLE_EQ(interp.linear(t), reference.linear(t));
+	EXPECT_NEAR(interp.exponential(t), reference.exponential(t), 1e-12);
+  }
+
+  for (size_t i = 0; i < N; i++) {
+	EXPECT_DOUBLE_EQ(interp.linear(x[i]), y[i]);
+  }
+}
+
+TEST(StaticInterp1dTest, TwoPoints) {
+  constexpr StaticInterp1d<float, 2> interp({0.0f, 1.0f}, {1.0f, 3.0f});
+
+  static_assert(interp.linear(0.25f) == 1.5f);
+  EXPECT_FLOAT_EQ(interp.exponential(0.5f), std::sqrt(3.0f));
+}
+
+} // namespace nuenv::test
@@ -125,4 +125,54 @@ TEST(DiffEvolutionTest, FitnessRosenbrock10Constraint) {
   }
 }
 
+TEST(DiffEvolutionTest, FitnessCallable) {
+  const VectorT<Vector2X<double>> bounds = {{-5.0, 5.0},
+											{-5.0, 5.0}};
+
+  auto fitness = [](const Vector2X<double>& x) {
+	return ackley(x);
+  };
+
+  // Called directly, without a 'Lambda'
+  DiffEvolution<double, Vector2X<double>, decltype(fitness)> opt(fitness, bounds);
+
+  auto sol = opt.optimize();
+
+  for (auto s : sol) {
+	EXPECT_NEAR(s, 0.0, 1e-4);
+  }
+}
+
+TEST(DiffEvolutionTest, InitialPopulationFloat) {
+  const VectorT<Vector2X<float>> bounds = {{-1.0f, 3.0f},
+										   {10.0f, 10.5f}};
+
+  auto fitness = [](const Vector2X<float>& x) {
+	return x.squaredNorm();
+  };
+
+  // The constraints see every individual of the initial population, and no
+  // other with no iterations
+  VectorT<Vector2X<float>> population;
+  const Lambda<float(Vector2X<float>)> constraint = [&population](const Vector2X<float>& x) {
+	population.push_back(x);
+	return 0.0f;
+  };
+
+  DiffEvolution<float, Vector2X<float>, decltype(fitness)> opt(fitness, bounds, constraint, 0);
+
+  for (size_t i = 0; i < 100; i++) {
+	population.clear();
+	opt.optimize();
+
+	ASSERT_EQ(population.size(), 32u);
+	for (const Vector2X<float>& x : population) {
+	  for (size_t j = 0; j < bounds.size(); j++) {
+		EXPECT_GE(x[j], bounds[j][0]);
+		EXPECT_LE(x[j], bounds[j][1]);
+	  }
+	}
+  }
+}
+
 } // namespace nuenv::test